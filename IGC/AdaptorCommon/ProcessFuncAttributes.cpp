@@ -658,7 +658,8 @@ bool ProcessFuncAttributes::runOnModule(Module& M)
                 }
                 if (shouldAlwaysInline)
                 {
-                    if ((IGC_IS_FLAG_ENABLED(ControlKernelTotalSize) || IGC_IS_FLAG_ENABLED(ControlUnitSize)) &&
+                    if ((IGC_IS_FLAG_ENABLED(ControlKernelTotalSize) || IGC_IS_FLAG_ENABLED(ControlUnitSize) ||
+                         IGC_IS_FLAG_ENABLED(ControlKernelCompileTime)) &&
                         efs.shouldEnableSubroutine() &&
                         efs.isTrimmedFunction(F))
                     {
@@ -114,6 +114,8 @@ void ZEBinaryBuilder::createKernel(
     }
 
     addGTPinInfo(annotations);
+    if (IGC_IS_FLAG_ENABLED(EnableZEBinThroughputInfo))
+        addThroughputInfo(annotations);
     addFunctionAttrs(annotations);
     for (auto &&[name, visa] : visaasm)
         addKernelVISAAsm(name, visa);
@@ -153,6 +155,33 @@ void ZEBinaryBuilder::addGTPinInfo(const IGC::SOpenCLKernelInfo& annotations)
     }
 }
 
+void ZEBinaryBuilder::addThroughputInfo(const IGC::SOpenCLKernelInfo& annotations)
+{
+    const IGC::SKernelProgram* program = &(annotations.m_kernelProgram);
+    const SProgramOutput* output = nullptr;
+    switch (annotations.m_executionEnvironment.CompiledSIMDSize) {
+    case 1:  output = &(program->simd1); break;
+    case 8:  output = &(program->simd8); break;
+    case 16: output = &(program->simd16); break;
+    case 32: output = &(program->simd32); break;
+    default: IGC_ASSERT(output != nullptr); return;
+    }
+
+    // Same order as vISA::PERF_BOTTLENECK.
+    static const char* const bottlenecks[] = { "none", "alu", "send", "sync" };
+    const char* bottleneck = output->m_estBottleneck < 4 ?
+        bottlenecks[output->m_estBottleneck] : "none";
+
+    std::string& info = mThroughputInfo.emplace_back();
+    info = "cycles: " + std::to_string(output->m_estCycles) +
+        "\nalu_cycles: " + std::to_string(output->m_estALUCycles) +
+        "\nsend_cycles: " + std::to_string(output->m_estSendCycles) +
+        "\nsync_cycles: " + std::to_string(output->m_estSyncCycles) +
+        "\nbottleneck: " + bottleneck + "\n";
+    addMiscInfoSection("throughput." + annotations.m_kernelName,
+        (const uint8_t*)info.data(), (uint32_t)info.size());
+}
+
 void ZEBinaryBuilder::addFunctionAttrs(const IGC::SOpenCLKernelInfo& annotations)
 {
     // get function attribute list from the current process SKernelProgram
@@ -707,6 +736,14 @@ void ZEBinaryBuilder::getElfSymbol(CElfReader* elfReader, const unsigned int sym
     unsigned int symtabEntrySize = sizeof(llvm::ELF::Elf64_Sym);
     symtabEntry = *(llvm::ELF::Elf64_Sym*)(symtabData + symtabIdx * symtabEntrySize);
 
+    // A section symbol is named after its section. Take that name from the section header, since .strtab may also
+    // hold the names of other symbols (e.g. type DIEs shared between kernels).
+    if (symtabEntry.getType() == ELF::STT_SECTION)
+    {
+        symName = const_cast<char*>(elfReader->GetSectionName(symtabEntry.st_shndx));
+        return;
+    }
+
     // Then find the name in .strtab (String Table), where data may look as showed below:
     //  .debug_abbrev .text.stackcall .debug_ranges .debug_str .debug_info
     // ^NULL         ^NULL           ^NULL         ^NULL      ^NULL       ^NULL
@@ -828,6 +865,20 @@ void ZEBinaryBuilder::addElfSections(void* elfBin, size_t elfSize)
                                 // a lookup into .symtab then we have to find this name in .strtab.
                                 getElfSymbol(elfReader, relocEntry.r_info >> 32 /*index*/, symtabEntry, symName);
 
+                                // A relocation against a named symbol defined in a debug section (e.g. a type DIE
+                                // shared between kernels) is rebased on the section symbol, like all the others.
+                                int64_t relocAddend = relocEntry.r_addend;
+                                const char* symSectionName = symtabEntry.st_shndx != ELF::SHN_UNDEF ?
+                                    elfReader->GetSectionName(symtabEntry.st_shndx) : nullptr;
+                                if (symtabEntry.getType() != ELF::STT_SECTION && symSectionName &&
+                                    !memcmp(symSectionName, ".debug", sizeof(".debug") - 1))
+                                {
+                                    relocAddend += symtabEntry.st_value;
+                                    symtabEntry.st_value = 0;
+                                    symtabEntry.setBindingAndType(ELF::STB_LOCAL, ELF::STT_SECTION);
+                                    symName = const_cast<char*>(symSectionName);
+                                }
+
                                 vISA::ZESymEntry zeSym(
                                     (vISA::GenSymType)symtabEntry.st_info,
                                     (uint32_t)symtabEntry.st_value,
@@ -866,7 +917,7 @@ void ZEBinaryBuilder::addElfSections(void* elfBin, size_t elfSize)
                                     IGC_ASSERT_MESSAGE(false, "Unsupported ELF relocation type");
 
                                 mBuilder.addRelaRelocation(
-                                    relocEntry.r_offset, zeSym.s_name, zebinType, relocEntry.r_addend, nonRelaSectionID);
+                                    relocEntry.r_offset, zeSym.s_name, zebinType, relocAddend, nonRelaSectionID);
                             }
                         }
                     }
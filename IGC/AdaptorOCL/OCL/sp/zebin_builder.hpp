@@ -8,6 +8,8 @@ SPDX-License-Identifier: MIT
 
 #pragma once
 
+#include <list>
+#include <string>
 #include <vector>
 #include <ZEELFObjectBuilder.hpp>
 #include "sp_g8.h"
@@ -198,6 +200,10 @@ private:
     /// into gtpin_info section
     void addGTPinInfo(const IGC::SOpenCLKernelInfo& annotations);
 
+    /// add .misc.throughput.<kernel> section with the static throughput
+    /// estimate of the kernel
+    void addThroughputInfo(const IGC::SOpenCLKernelInfo& annotations);
+
     /// Add function attributes for external functions.
     void addFunctionAttrs(const IGC::SOpenCLKernelInfo& annotations);
 
@@ -242,6 +248,10 @@ private:
     zebin::ZEELFObjectBuilder::SectionID mGlobalConstSectID = -1;
     zebin::ZEELFObjectBuilder::SectionID mConstStringSectID = -1;
     zebin::ZEELFObjectBuilder::SectionID mGlobalSectID = -1;
+
+    /// holder of the .misc.throughput sections' contents, which have to be
+    /// alive until the binary is written
+    std::list<std::string> mThroughputInfo;
 };
 
 // a helper function to get ZE image type from a OCL image type
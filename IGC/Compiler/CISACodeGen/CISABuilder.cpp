@@ -19,6 +19,7 @@ SPDX-License-Identifier: MIT
 #include "common/secure_mem.h"
 #include "common/secure_string.h"
 #include "common/shaderOverride.hpp"
+#include "DebugInfo/VISADebugInfo.hpp"
 #include "inc/common/sku_wa.h"
 #include <llvm/Support/Path.h>
 #include <llvm/ADT/Statistic.h>
@@ -4007,6 +4008,10 @@ namespace IGC
         bool AllowSpill = true;
 
         SaveOption(vISA_Linker, IGC_GET_FLAG_VALUE(VISALTO));
+        if (hasStackCall && IGC_GET_FLAG_VALUE(VISAParallelFuncCompile) > 1)
+        {
+            SaveOption(vISA_ParallelFuncCompile, IGC_GET_FLAG_VALUE(VISAParallelFuncCompile));
+        }
         if (context->type == ShaderType::OPENCL_SHADER)
         {
             auto ClContext = static_cast<OpenCLProgramContext*>(context);
@@ -4222,6 +4227,11 @@ namespace IGC
                 SaveOption(vISA_preRA_ScheduleExtraGRF, Val);
             }
 
+            if (IGC_IS_FLAG_ENABLED(VISAPreSchedSuperblock))
+            {
+                SaveOption(vISA_preRA_ScheduleSuperblock, true);
+            }
+
             if (uint32_t Val = IGC_GET_FLAG_VALUE(VISAScheduleStartBBID))
             {
                 SaveOption(vISA_ScheduleStartBBID, Val);
@@ -4494,6 +4504,11 @@ namespace IGC
             SaveOption(vISA_ForceAssignRhysicalReg, str);
         }
 
+        if (auto *str = IGC_GET_REGKEYSTRING(VISABlockProfile))
+        {
+            SaveOption(vISA_BlockProfile, str);
+        }
+
         // In Vulkan and OGL buffer variable memory reads and writes within
         // a single shader invocation must be processed in order.
         if (m_program->m_DriverInfo->DisableDpSendReordering())
@@ -6174,6 +6189,10 @@ namespace IGC
 
         vISA::FINALIZER_INFO* jitInfo = nullptr;
 
+        // Unless the raw .dbg file is dumped, vISA hands the debug mapping
+        // tables over directly rather than as a binary we'd decode again.
+        std::unique_ptr<IGC::DbgDecoderBuilder> dbgDecoderBuilder;
+
         // Compile generated VISA text string for inlineAsm
         if (m_hasInlineAsm || visaAsmOverride || additionalVISAAsmToLink)
         {
@@ -6191,6 +6210,16 @@ namespace IGC
             pMainKernel->GetJitInfo(jitInfo);
 
             jitInfo->stats.scratchSpaceSizeLimit = m_program->ProgramOutput()->m_scratchSpaceSizeLimit;
+            // Only DebugInfoPass reads the tables the sink builds. It runs for
+            // OpenCL shaders that have a debug emitter; everything else reads
+            // the binary debug info from m_debugDataGenISA.
+            if (context->m_instrTypes.hasDebugInfo && !m_enableVISAdump &&
+                context->type == ShaderType::OPENCL_SHADER &&
+                m_program->GetDebugInfoData().m_pDebugEmitter)
+            {
+                dbgDecoderBuilder = std::make_unique<IGC::DbgDecoderBuilder>();
+                V(pMainKernel->SetGenxDebugInfoSink(dbgDecoderBuilder.get()));
+            }
             m_vIsaCompileStatus = vbuilder->Compile(
                 m_enableVISAdump ? GetDumpFileName("isa").c_str() : "", nullptr, emitVisaOnly);
         }
@@ -6209,6 +6238,7 @@ namespace IGC
         pMainKernel->GetKernelInfo(vISAstats);
         // Collect metrics from vISA
         context->metrics.CollectRegStats(vISAstats, m_program->entry);
+        context->metrics.CollectThroughputEstimate(jitInfo->stats, m_program->entry);
 
         // Depend on vISA information about barriers presence to make sure that it's
         // always set properly, even if a barrier is used as a part of Inline vISA code only.
@@ -6375,7 +6405,16 @@ namespace IGC
 
         void* dbgInfo = nullptr;
         unsigned int dbgSize = 0;
-        if (context->m_instrTypes.hasDebugInfo || m_enableVISAdump)
+        if (dbgDecoderBuilder)
+        {
+            V(pMainKernel->SetGenxDebugInfoSink(nullptr));
+            if (!dbgDecoderBuilder->empty())
+            {
+                pOutput->m_VISADebugInfo =
+                    std::make_shared<IGC::VISADebugInfo>(dbgDecoderBuilder->take());
+            }
+        }
+        else if (context->m_instrTypes.hasDebugInfo || m_enableVISAdump)
         {
             void* genxdbgInfo = nullptr;
             V(pMainKernel->GetGenxDebugInfo(genxdbgInfo, dbgSize));
@@ -6419,6 +6458,11 @@ namespace IGC
         pOutput->m_debugDataGenISASize = dbgSize;
         pOutput->m_InstructionCount = jitInfo->stats.numAsmCountUnweighted;
         pOutput->m_BasicBlockCount = jitInfo->BBNum;
+        pOutput->m_estCycles = jitInfo->stats.estCycle;
+        pOutput->m_estALUCycles = jitInfo->stats.estALUCycle;
+        pOutput->m_estSendCycles = jitInfo->stats.estSendCycle;
+        pOutput->m_estSyncCycles = jitInfo->stats.estSyncCycle;
+        pOutput->m_estBottleneck = (unsigned char)jitInfo->stats.estBottleneck;
 
         pMainKernel->GetGTPinBuffer(pOutput->m_gtpinBuffer, pOutput->m_gtpinBufferSize);
 
@@ -9,6 +9,7 @@ SPDX-License-Identifier: MIT
 #include "common/LLVMWarningsPush.hpp"
 #include <llvm/IR/Function.h>
 #include <llvmWrapper/IR/DerivedTypes.h>
+#include <llvm/Support/MathExtras.h>
 #include "common/LLVMWarningsPop.hpp"
 #include "AdaptorCommon/ImplicitArgs.hpp"
 #include "Compiler/CISACodeGen/ShaderCodeGen.hpp"
@@ -22,6 +23,7 @@ SPDX-License-Identifier: MIT
 #include "Compiler/MetaDataApi/MetaDataApi.h"
 #include "common/secure_mem.h"
 #include "Probe/Assertion.h"
+#include "common/debug/Debug.hpp"
 
 #include <iomanip>
 
@@ -120,6 +122,7 @@ void CShader::InitEncoder(SIMDMode simdSize, bool canAbortOnSpill, ShaderDispatc
     setup.clear();
     patchConstantSetup.clear();
     kernelArgToPayloadOffsetMap.clear();
+    ResetUniformScalarPacking();
     encoder.SetProgram(this);
 }
 
@@ -2570,6 +2573,7 @@ void CShader::BeginFunction(llvm::Function* F)
     symbolMapping.clear();
     ccTupleMapping.clear();
     ConstantPool.clear();
+    ResetUniformScalarPacking();
 
     bool useStackCall = m_FGA && m_FGA->useStackCall(F);
     if (useStackCall)
@@ -2935,6 +2939,171 @@ CVariable* CShader::GetSymbolFromSource(Instruction* UseInst,
     return nullptr;
 }
 
+void CShader::ResetUniformScalarPacking()
+{
+    m_UniformPackGroup.clear();
+    m_UniformPacks.clear();
+    m_UniformPackPlanned = false;
+    m_NumPackedUniformScalars = 0;
+    m_NumUniformPackGRFs = 0;
+    m_UniformPackedBytes = 0;
+    m_NumUnpackedUniformScalars = 0;
+}
+
+// Uniform scalars defined in the entry block and used in other blocks
+// usually live for most of the function (bases, bounds, group ids, ...).
+// As partial writes do not kill the packed variable, only such long-lived
+// values are considered; short-lived locals are left to RA.
+bool CShader::IsPackableUniformScalar(Value* value)
+{
+    Instruction* Inst = dyn_cast<Instruction>(value);
+    if (!Inst || isa<PHINode>(Inst))
+        return false;
+
+    Type* Ty = value->getType();
+    if (!(Ty->isIntegerTy() || Ty->isFloatingPointTy() || Ty->isPointerTy()) ||
+        Ty->isIntegerTy(1))
+        return false;
+
+    WIBaseClass::WIDependancy dep = GetDependency(value);
+    if (!WIAnalysis::isDepUniform(dep))
+        return false;
+
+    BasicBlock* EntryBB = &Inst->getFunction()->getEntryBlock();
+    if (Inst->getParent() != EntryBB)
+        return false;
+
+    bool usedOutsideEntry = false;
+    for (auto* U : Inst->users())
+    {
+        auto* UI = dyn_cast<Instruction>(U);
+        if (UI && UI->getParent() != EntryBB)
+        {
+            usedOutsideEntry = true;
+            break;
+        }
+    }
+    if (!usedOutsideEntry)
+        return false;
+
+    if (auto* II = dyn_cast<IntrinsicInst>(Inst))
+    {
+        if (II->getIntrinsicID() == Intrinsic::stacksave)
+            return false;
+    }
+
+    // Lifetime.start on an aliased root would kill the other packed values.
+    if (m_VRA && (m_VRA->isAliasedValue(value) ||
+        m_VRA->m_LifetimeAt1stDefOfBB.count(value)))
+        return false;
+
+    // Values that DeSSA coalesces with others share their register.
+    if (m_deSSA->getRootValue(value))
+        return false;
+
+    uint32_t eltSize = CEncoder::GetCISADataTypeSize(GetType(Ty));
+    return eltSize != 0 && eltSize <= 8;
+}
+
+// A pack GRF is live wherever any of its members is. To never make a
+// member live longer than it would be on its own, group the candidates by
+// the blocks they are live through and killed in, and only pack groups of
+// two or more.
+void CShader::PlanUniformScalarPacking(Function* F)
+{
+    m_UniformPackPlanned = true;
+    if (!m_deSSA)
+        return;
+    LiveVars* LV = m_deSSA->getLiveVars();
+
+    typedef std::vector<BasicBlock*> LiveBlocks;
+    std::map<std::pair<LiveBlocks, LiveBlocks>, SmallVector<Value*, 8>> groups;
+    for (Instruction& I : F->getEntryBlock())
+    {
+        if (!IsPackableUniformScalar(&I))
+            continue;
+        LiveVars::LVInfo& info = LV->getLVInfo(&I);
+        LiveBlocks alive(info.AliveBlocks.begin(), info.AliveBlocks.end());
+        LiveBlocks killed;
+        for (Instruction* K : info.Kills)
+            killed.push_back(K->getParent());
+        llvm::sort(alive);
+        llvm::sort(killed);
+        killed.erase(std::unique(killed.begin(), killed.end()), killed.end());
+        groups[std::make_pair(std::move(alive), std::move(killed))]
+            .push_back(&I);
+    }
+
+    for (auto& group : groups)
+    {
+        if (group.second.size() < 2)
+        {
+            ++m_NumUnpackedUniformScalars;
+            continue;
+        }
+        unsigned index = m_UniformPacks.size();
+        m_UniformPacks.emplace_back();
+        for (Value* V : group.second)
+            m_UniformPackGroup[V] = index;
+    }
+}
+
+// Return an alias at a naturally aligned sub-register offset of the pack
+// GRF of value's group, or nullptr if value is not packed.
+CVariable* CShader::GetPackedUniformScalar(Value* value,
+    e_alignment preferredAlign)
+{
+    if (IGC_IS_FLAG_DISABLED(PackUniformScalars))
+        return nullptr;
+
+    // Values feeding sends etc. need a specific alignment.
+    if (preferredAlign != EALIGN_AUTO)
+        return nullptr;
+
+    Instruction* Inst = dyn_cast<Instruction>(value);
+    if (!Inst)
+        return nullptr;
+    if (!m_UniformPackPlanned)
+        PlanUniformScalarPacking(Inst->getFunction());
+
+    auto it = m_UniformPackGroup.find(value);
+    if (it == m_UniformPackGroup.end())
+        return nullptr;
+    UniformPack& pack = m_UniformPacks[it->second];
+
+    VISA_Type type = GetType(value->getType());
+    uint32_t eltSize = CEncoder::GetCISADataTypeSize(type);
+    uint32_t offset = (uint32_t)llvm::alignTo(pack.offset, eltSize);
+    if (!pack.var || offset + eltSize > getGRFSize())
+    {
+        pack.var = GetNewVariable(
+            (uint16_t)getGRFSize(), ISA_TYPE_UB, EALIGN_GRF,
+            WIBaseClass::UNIFORM_THREAD, 1, "UniformPack");
+        ++m_NumUniformPackGRFs;
+        offset = 0;
+    }
+    pack.offset = offset + eltSize;
+    ++m_NumPackedUniformScalars;
+    m_UniformPackedBytes += eltSize;
+
+    return GetNewAlias(pack.var, type, (uint16_t)offset, 1, true);
+}
+
+void CShader::ReportUniformScalarPacking(Function* F) const
+{
+    if (IGC_IS_FLAG_DISABLED(DumpUniformScalarPacking) ||
+        (m_NumPackedUniformScalars == 0 && m_NumUnpackedUniformScalars == 0))
+        return;
+
+    IGC::Debug::ods() << "UniformScalarPacking: " << F->getName()
+        << " SIMD" << numLanes(m_dispatchSize)
+        << ": packed " << m_NumPackedUniformScalars << " scalars ("
+        << m_UniformPackedBytes << " bytes) into "
+        << m_NumUniformPackGRFs << " GRF(s), left "
+        << m_NumUnpackedUniformScalars
+        << " scalar(s) with a live range of their own unpacked\n";
+}
+
 unsigned int CShader::EvaluateSIMDConstExpr(Value* C)
 {
     if (BinaryOperator * op = dyn_cast<BinaryOperator>(C))
@@ -3291,7 +3460,14 @@ CVariable* CShader::GetSymbol(llvm::Value* value, bool fromConstantPool)
         }
         else
         {
-            var = GetNewVector(value, preferredAlign);
+            if (!rootValue)
+            {
+                var = GetPackedUniformScalar(value, preferredAlign);
+            }
+            if (!var)
+            {
+                var = GetNewVector(value, preferredAlign);
+            }
         }
     }
 
@@ -104,6 +104,7 @@ bool DebugInfoPass::runOnModule(llvm::Module& M)
         return currShader;
     };
 
+    bool singleVariantKernels = true;
     for (auto& k : kernels)
     {
         auto shaderProgram = k.second;
@@ -114,10 +115,25 @@ bool DebugInfoPass::runOnModule(llvm::Module& M)
         if (simd8) units.push_back(simd8);
         if (simd16) units.push_back(simd16);
         if (simd32) units.push_back(simd32);
+
+        if ((simd8 != nullptr) + (simd16 != nullptr) + (simd32 != nullptr) > 1)
+            singleVariantKernels = false;
     }
 
     DwarfDISubprogramCache DISPCache;
 
+    // Shared DIEs are referenced across the kernel ELFs, which only works
+    // when all of them are linked into one zebinary, so no kernel may have
+    // a SIMD variant that gets dropped.
+    std::unique_ptr<DwarfTypePool> TypePool;
+    if (IGC_GET_FLAG_VALUE(DebugInfoShareTypes) && units.size() > 1 &&
+        singleVariantKernels &&
+        IGC_IS_FLAG_ENABLED(ZeBinCompatibleDebugging) &&
+        units.front()->GetContext()->enableZEBinary())
+    {
+        TypePool = std::make_unique<DwarfTypePool>(IGC_GET_FLAG_VALUE(DebugInfoShareTypes));
+    }
+
     for (auto& currShader : units)
     {
         // Look for the right CShaderProgram instance
@@ -133,7 +149,10 @@ bool DebugInfoPass::runOnModule(llvm::Module& M)
         std::vector<std::pair<unsigned int, std::pair<llvm::Function*, IGC::VISAModule*>>> sortedVISAModules;
 
         // Sort modules in order of their placement in binary
-        IGC::VISADebugInfo VisaDbgInfo(m_currShader->ProgramOutput()->m_debugDataGenISA);
+        std::shared_ptr<IGC::VISADebugInfo> VisaDbgInfoPtr = m_currShader->ProgramOutput()->m_VISADebugInfo;
+        if (!VisaDbgInfoPtr)
+            VisaDbgInfoPtr = std::make_shared<IGC::VISADebugInfo>(m_currShader->ProgramOutput()->m_debugDataGenISA);
+        const IGC::VISADebugInfo& VisaDbgInfo = *VisaDbgInfoPtr;
         const auto &decodedDbg = VisaDbgInfo.getRawDecodedData();
         auto getGenOff = [&decodedDbg](const std::vector<std::pair<unsigned int, unsigned int>>& data,
                                        unsigned int VISAIndex)
@@ -251,6 +270,8 @@ bool DebugInfoPass::runOnModule(llvm::Module& M)
         });
 
         m_pDebugEmitter->SetDISPCache(&DISPCache);
+        if (TypePool)
+            m_pDebugEmitter->SetTypePool(TypePool.get());
         for (auto& m : sortedVISAModules)
         {
             m_pDebugEmitter->registerVISA(m.second.second);
@@ -277,6 +298,7 @@ bool DebugInfoPass::runOnModule(llvm::Module& M)
         }
         currShader->ProgramOutput()->m_debugDataGenISASize = 0;
         currShader->ProgramOutput()->m_debugDataGenISA = nullptr;
+        currShader->ProgramOutput()->m_VISADebugInfo.reset();
 
         m_currShader->GetContext()->metrics.CollectDataFromDebugInfo(
             m_currShader->entry,
@@ -288,6 +310,9 @@ bool DebugInfoPass::runOnModule(llvm::Module& M)
         }
     }
 
+    if (TypePool && IGC_IS_FLAG_ENABLED(PrintDebugInfoShareTypes))
+        TypePool->print(llvm::errs());
+
     return false;
 }
 
@@ -1149,6 +1149,8 @@ bool EmitPass::runOnFunction(llvm::Function& F)
         delete llvmtoVISADump;
     }
 
+    m_currShader->ReportUniformScalarPacking(&F);
+
     if (m_FGA && IGC_IS_FLAG_ENABLED(ForceSubReturn))
     {
         bool hasReturn = false;
@@ -16,6 +16,7 @@ SPDX-License-Identifier: MIT
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/Instructions.h"
+#include "llvm/IR/InstIterator.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Analysis/BlockFrequencyInfo.h"
 #include "llvm/Analysis/BranchProbabilityInfo.h"
@@ -108,6 +109,7 @@ namespace {
 #define PrintControlKernelTotalSize(hex_val,contents) if ((IGC_GET_FLAG_VALUE(PrintControlKernelTotalSize) & hex_val) != 0) {dbgs() << "ControlKernelTotalSize0x" << hex_val << ": " << contents << "\n";}
 #define PrintTrimUnit(hex_val,contents) if ((IGC_GET_FLAG_VALUE(PrintControlKernelTotalSize) & hex_val) != 0 || (IGC_GET_FLAG_VALUE(PrintControlUnitSize) & hex_val) != 0) {dbgs() << "TrimUnit0x" << hex_val << ": " << contents << "\n";}
 #define PrintFunctionSizeAnalysis(hex_val,contents) if ((IGC_GET_FLAG_VALUE(PrintFunctionSizeAnalysis) & hex_val) != 0) {dbgs() << "FunctionSizeAnalysis0x" << hex_val << ": " << contents << "\n";}
+#define PrintKernelCompileTimeBudget(hex_val,contents) if ((IGC_GET_FLAG_VALUE(PrintKernelCompileTimeBudget) & hex_val) != 0) {dbgs() << "KernelCompileTimeBudget0x" << hex_val << ": " << contents << "\n";}
 #define PrintStaticProfilingForKernelSizeReduction(hex_val,contents) if ((IGC_GET_FLAG_VALUE(PrintStaticProfilingForKernelSizeReduction) & hex_val) != 0) {dbgs() << "StaticProfilingForKernelSizeReduction0x" << hex_val << ": " << contents << "\n";}
 
     typedef enum
@@ -141,10 +143,20 @@ namespace {
         FT_HIGHER_WEIGHT = (0x1 << 0x5),    /// \brief a flag to indicate the function has higher weight than threshold
         FT_LOWER_WEIGHT = (0x1 << 0x6),    /// \brief a flag to indicate the function has lower weight than threshold
     } FUNCTION_TRAIT_FLAG_t;
+    /// \brief Estimated backend compile cost of a unit. Liveness and RA dominate
+    /// it, and their work grows with the number of live ranges times the number
+    /// of program points (blocks for the dataflow, instructions for interference).
+    uint64_t estimateCompileCost(uint64_t Insts, uint64_t Blocks, uint64_t LiveRanges)
+    {
+        return (Insts + Blocks) * LiveRanges;
+    }
+
     struct FunctionNode {
-        FunctionNode(Function* F, std::size_t Size)
+        FunctionNode(Function* F, std::size_t Size, uint32_t Blocks, uint32_t LiveRanges)
             : F(F), InitialSize(Size), UnitSize(Size), ExpandedSize(Size), Inline_cnt(0), tmpSize(Size), CallingSubroutine(false),
-            FunctionAttr(0), InMultipleUnit(false), HasImplicitArg(false), staticFuncFreq(0,0) {}
+            FunctionAttr(0), InMultipleUnit(false), HasImplicitArg(false), staticFuncFreq(0,0),
+            InitialBlocks(Blocks), ExpandedBlocks(Blocks), tmpBlocks(Blocks),
+            InitialLiveRanges(LiveRanges), ExpandedLiveRanges(LiveRanges), tmpLiveRanges(LiveRanges), CompileCost(0) {}
 
         Function* F;
 
@@ -180,6 +192,17 @@ namespace {
 
         bool HasImplicitArg;
 
+        /// \brief Block and live range counts before and after expansion, used by
+        /// the compile time budget. They are updated together with the sizes.
+        uint32_t InitialBlocks;
+        uint32_t ExpandedBlocks;
+        uint32_t tmpBlocks;
+        uint32_t InitialLiveRanges;
+        uint32_t ExpandedLiveRanges;
+        uint32_t tmpLiveRanges;
+
+        /// \brief Estimated compile cost of the unit headed by this node
+        uint64_t CompileCost;
 
         /// \brief All functions directly called in this function.
         std::unordered_map<FunctionNode*, uint16_t> CalleeList;
@@ -361,6 +384,8 @@ namespace {
             }
             uint32_t sizeIncrease = callee->ExpandedSize * CalleeList[callee];
             tmpSize += sizeIncrease;
+            tmpBlocks += callee->ExpandedBlocks * CalleeList[callee];
+            tmpLiveRanges += callee->ExpandedLiveRanges * CalleeList[callee];
         }
 #if defined(_DEBUG)
         void print(raw_ostream& os);
@@ -668,6 +693,19 @@ void EstimateFunctionSize::analyze() {
             Size += IGCLLVM::sizeWithoutDebug(&BB);
         return Size;
     };
+    // Values live across blocks are the ones that make it to global RA.
+    auto getLiveRanges = [](llvm::Function& F) -> uint32_t {
+        uint32_t LiveRanges = F.arg_size();
+        for (auto& I : instructions(F)) {
+            for (auto U : I.users()) {
+                if (cast<Instruction>(U)->getParent() != I.getParent()) {
+                    ++LiveRanges;
+                    break;
+                }
+            }
+        }
+        return LiveRanges;
+    };
 
     auto MdWrapper = getAnalysisIfAvailable<MetaDataUtilsWrapper>();
     auto pMdUtils = MdWrapper->getMetaDataUtils();
@@ -676,7 +714,8 @@ void EstimateFunctionSize::analyze() {
     for (auto& F : M->getFunctionList()) {
         if (F.empty())
             continue;
-        FunctionNode* node = new FunctionNode(&F, getSize(F));
+        uint32_t LiveRanges = IGC_IS_FLAG_ENABLED(ControlKernelCompileTime) ? getLiveRanges(F) : 0;
+        FunctionNode* node = new FunctionNode(&F, getSize(F), (uint32_t)F.size(), LiveRanges);
         bool isForceTrim = false;
         if (IGC_IS_FLAG_ENABLED(SelectiveTrimming))
         {
@@ -883,6 +922,14 @@ void EstimateFunctionSize::checkSubroutine() {
             }
             PrintTrimUnit(0x1, "-----------------------------Trimming end-----------------------------\n")
         }
+
+        // The compile time budget applies even when the kernels are small enough
+        // not to need trimming for size.
+        if (AL == AL_Module && IGC_IS_FLAG_DISABLED(DisableAddingAlwaysAttribute) &&
+            IGC_IS_FLAG_ENABLED(ControlKernelCompileTime) && reduceKernelCompileTime())
+        {
+            EnableSubroutine = true;
+        }
     }
     IGC_ASSERT(!HasRecursion || EnableSubroutine);
     return;
@@ -944,6 +991,59 @@ void EstimateFunctionSize::reduceKernelSize() {
 }
 
 
+//Trim kernels whose estimated compile cost exceeds the budget. Functions that are
+//inlined at the most call sites (largest size contribution) are trimmed first, as
+//each of them removes the most instructions, blocks and live ranges.
+//Returns true if any function was trimmed.
+bool EstimateFunctionSize::reduceKernelCompileTime() {
+    uint64_t budget = IGC_GET_FLAG_VALUE(KernelCompileTimeBudget);
+    llvm::SmallVector<void*, 64> unitHeads;
+    for (auto node : kernelEntries)
+        unitHeads.push_back((FunctionNode*)node);
+    for (auto node : addressTakenFuncs)
+        unitHeads.push_back((FunctionNode*)node);
+
+    bool changed = false;
+    for (auto node : unitHeads)
+    {
+        FunctionNode* unit = (FunctionNode*)node;
+        updateExpandedUnitSize(unit->F, true);
+        PrintKernelCompileTimeBudget(0x1, "Kernel / Unit " << unit->F->getName().str() << " expSize= " << unit->ExpandedSize
+            << " cost= " << unit->CompileCost << (unit->CompileCost > budget ? " > " : " <= ") << budget)
+        if (unit->CompileCost <= budget)
+            continue;
+
+        SmallVector<void*, 64> trimming_pool;
+        uint32_t func_cnt = 0;
+        getFunctionsToTrim(unit->F, trimming_pool, true, func_cnt);
+        uint64_t cost_before_trimming = unit->CompileCost;
+        while (!trimming_pool.empty() && unit->CompileCost > budget)
+        {
+            updateInlineCnt(unit->F);
+            std::sort(trimming_pool.begin(), trimming_pool.end(),
+                [&](const void* LHS, const void* RHS) {
+                    return ((FunctionNode*)LHS)->getSizeContribution() < ((FunctionNode*)RHS)->getSizeContribution();
+                });
+            FunctionNode* functionToTrim = (FunctionNode*)trimming_pool.back();
+            trimming_pool.pop_back();
+            if (functionToTrim->InitialSize == functionToTrim->getSizeContribution()) //Inlined once, trimming doesn't shrink the kernel
+            {
+                PrintKernelCompileTimeBudget(0x2, "Keep inlining " << functionToTrim->F->getName().str() << " (single inlined copy)")
+                continue;
+            }
+            uint64_t original_cost = unit->CompileCost;
+            functionToTrim->setTrimmed();
+            changed = true;
+            updateExpandedUnitSize(unit->F, true);
+            PrintKernelCompileTimeBudget(0x2, "Trim " << functionToTrim->F->getName().str() << " size contribution: " << functionToTrim->getSizeContribution()
+                << " cost " << original_cost << " -> " << unit->CompileCost)
+        }
+        PrintKernelCompileTimeBudget(0x1, "Kernel / Unit " << unit->F->getName().str() << " final cost " << unit->CompileCost
+            << " reduced from " << cost_before_trimming << (unit->CompileCost > budget ? " (still over budget)" : ""))
+    }
+    return changed;
+}
+
 bool EstimateFunctionSize::isTrimmedFunction( llvm::Function* F) {
     return get<FunctionNode>(F)->isTrimmed();
 }
@@ -963,6 +1063,8 @@ void EstimateFunctionSize::initializeTopologicalVisit(Function* root, std::unord
     while (!Queue.empty()) {
         FunctionNode* Node = Queue.front();Queue.pop_front();
         Node->tmpSize = Node->InitialSize;
+        Node->tmpBlocks = Node->InitialBlocks;
+        Node->tmpLiveRanges = Node->InitialLiveRanges;
         for (auto Callee : Node->CalleeList) {
             FunctionNode* CalleeNode = Callee.first;
             if (FunctionsInKernel.find(CalleeNode) != FunctionsInKernel.end())
@@ -1040,16 +1142,22 @@ uint32_t EstimateFunctionSize::updateExpandedUnitSize(Function* F, bool ignoreSt
     std::unordered_map<void*, uint32_t> FunctionsInUnit;
     initializeTopologicalVisit(root->F, FunctionsInUnit, BottomUpQueue, ignoreStackCallBoundary);
     uint32_t unitTotalSize = 0;
+    uint64_t unitBlocks = 0;
+    uint64_t unitLiveRanges = 0;
     while (!BottomUpQueue.empty()) //Topologically visit nodes and collape for each compilation unit
     {
         FunctionNode* node = (FunctionNode*)BottomUpQueue.front();BottomUpQueue.pop_front();
         IGC_ASSERT(FunctionsInUnit[node] == 0);
         FunctionsInUnit.erase(node);
         node->ExpandedSize = node->tmpSize; //Update the size of an expanded chunk
+        node->ExpandedBlocks = node->tmpBlocks;
+        node->ExpandedLiveRanges = node->tmpLiveRanges;
         if (!node->willBeInlined())
         {
             //dbgs() << "Not be inlined Attr: " << (int)node->FunctionAttr << "\n";
             unitTotalSize += node->ExpandedSize;
+            unitBlocks += node->ExpandedBlocks;
+            unitLiveRanges += node->ExpandedLiveRanges;
         }
 
         for (auto c : node->CallerList)
@@ -1071,6 +1179,7 @@ uint32_t EstimateFunctionSize::updateExpandedUnitSize(Function* F, bool ignoreSt
     if (!FunctionsInUnit.empty())
         HasRecursion = true;
 
+    root->CompileCost = estimateCompileCost(unitTotalSize, unitBlocks, unitLiveRanges);
     return root->ExpandedSize = unitTotalSize;
 }
 
@@ -67,6 +67,7 @@ namespace IGC {
         void checkSubroutine();
         void clear();
         void reduceKernelSize();
+        bool reduceKernelCompileTime();
 
         /// \brief Return the associated opaque data.
         template <typename T> T* get(llvm::Function* F) {
@@ -0,0 +1,380 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2023 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#include "Compiler/CISACodeGen/LoopLoadPipelining.h"
+#include "Compiler/CISACodeGen/RegisterPressureEstimate.hpp"
+#include "Compiler/CISACodeGen/WIAnalysis.hpp"
+#include "Compiler/CodeGenContextWrapper.hpp"
+#include "Compiler/CodeGenPublic.h"
+#include "Compiler/IGCPassSupport.h"
+#include "GenISAIntrinsics/GenIntrinsicInst.h"
+#include "common/igc_regkeys.hpp"
+#include "common/LLVMWarningsPush.hpp"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/ValueTracking.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Instructions.h"
+#include "common/LLVMWarningsPop.hpp"
+#include "Probe/Assertion.h"
+
+using namespace llvm;
+using namespace IGC;
+
+namespace {
+
+// Max depth of the address/condition computations that are moved and cloned.
+constexpr unsigned MAX_CHAIN_DEPTH = 16;
+
+class LoopLoadPipelining : public FunctionPass {
+public:
+    static char ID;
+
+    LoopLoadPipelining() : FunctionPass(ID)
+    {
+        initializeLoopLoadPipeliningPass(*PassRegistry::getPassRegistry());
+    }
+
+    StringRef getPassName() const override { return "LoopLoadPipelining"; }
+
+    void getAnalysisUsage(AnalysisUsage& AU) const override
+    {
+        AU.setPreservesCFG();
+        AU.addRequired<CodeGenContextWrapper>();
+        AU.addRequired<LoopInfoWrapperPass>();
+        AU.addRequired<WIAnalysis>();
+        AU.addRequired<RegisterPressureEstimate>();
+    }
+
+    bool runOnFunction(Function& F) override;
+
+private:
+    bool isCandidateLoop(Loop* L) const;
+    bool isCandidateLoad(Instruction* I) const;
+    bool collectChain(Value* V, SetVector<Instruction*>& Chain, unsigned Depth) const;
+    void moveToTop(const SetVector<Instruction*>& Chain);
+    Value* getValueIn(Value* V, BasicBlock* From, IRBuilder<>& B,
+                      DenseMap<Value*, Value*>& Map) const;
+    bool pipelineLoad(Instruction* I);
+    bool pipelineLoop(Loop* L, unsigned Pressure);
+
+    RegisterPressureEstimate* RPE = nullptr;
+    WIAnalysis* WI = nullptr;
+    LoopInfo* LI = nullptr;
+    const DataLayout* DL = nullptr;
+
+    unsigned SimdSize = 16;
+    unsigned Budget = 0;
+
+    // The loop being transformed; its header is also its latch.
+    Loop* CurLoop = nullptr;
+    BasicBlock* Header = nullptr;
+    BasicBlock* Preheader = nullptr;
+    // First instruction after the computations moved to the top of Header.
+    Instruction* InsertPt = nullptr;
+};
+
+} // end namespace
+
+FunctionPass* IGC::createLoopLoadPipeliningPass()
+{
+    return new LoopLoadPipelining();
+}
+
+char LoopLoadPipelining::ID = 0;
+
+#define PASS_FLAG     "igc-loop-load-pipelining"
+#define PASS_DESC     "Software pipelining of loads in counted loops"
+#define PASS_CFG_ONLY false
+#define PASS_ANALYSIS false
+namespace IGC {
+IGC_INITIALIZE_PASS_BEGIN(LoopLoadPipelining, PASS_FLAG, PASS_DESC, PASS_CFG_ONLY, PASS_ANALYSIS)
+IGC_INITIALIZE_PASS_DEPENDENCY(CodeGenContextWrapper)
+IGC_INITIALIZE_PASS_DEPENDENCY(LoopInfoWrapperPass)
+IGC_INITIALIZE_PASS_DEPENDENCY(WIAnalysis)
+IGC_INITIALIZE_PASS_DEPENDENCY(RegisterPressureEstimate)
+IGC_INITIALIZE_PASS_END(LoopLoadPipelining, PASS_FLAG, PASS_DESC, PASS_CFG_ONLY, PASS_ANALYSIS)
+}
+
+bool LoopLoadPipelining::runOnFunction(Function& F)
+{
+    CodeGenContext* pCtx = getAnalysis<CodeGenContextWrapper>().getCodeGenContext();
+    RPE = &getAnalysis<RegisterPressureEstimate>();
+    WI = &getAnalysis<WIAnalysis>();
+    LI = &getAnalysis<LoopInfoWrapperPass>().getLoopInfo();
+    DL = &F.getParent()->getDataLayout();
+
+    if (!RPE->isAvailable())
+        return false;
+
+    SimdSize = IGC_GET_FLAG_VALUE(LoopLoadPipeliningSIMD);
+    Budget = IGC_GET_FLAG_VALUE(LoopLoadPipeliningBudget);
+    if (Budget == 0)
+    {
+        Budget = pCtx->getNumGRFPerThread() * pCtx->platform.getGRFSize();
+    }
+
+    // Take the estimate of every loop before changing anything. Loops are
+    // single blocks, so transforming one does not affect the others.
+    SmallVector<std::pair<Loop*, unsigned>, 8> Loops;
+    for (Loop* L : LI->getLoopsInPreorder())
+    {
+        if (isCandidateLoop(L))
+        {
+            // The estimate is in bytes per lane for non-uniform values.
+            unsigned Pressure = RPE->getMaxRegisterPressure(L->getHeader()) * SimdSize;
+            Loops.push_back(std::make_pair(L, Pressure));
+        }
+    }
+
+    bool Changed = false;
+    for (auto& LP : Loops)
+    {
+        Changed |= pipelineLoop(LP.first, LP.second);
+    }
+    return Changed;
+}
+
+// Innermost single-block loops with a preheader whose trip count is decided
+// by the latch branch, and which do not write memory.
+bool LoopLoadPipelining::isCandidateLoop(Loop* L) const
+{
+    if (!L->getSubLoops().empty() || L->getNumBlocks() != 1 ||
+        !L->getLoopPreheader())
+        return false;
+
+    BasicBlock* BB = L->getHeader();
+    auto* BI = dyn_cast<BranchInst>(BB->getTerminator());
+    if (!BI || !BI->isConditional() || L->getExitingBlock() != BB)
+        return false;
+
+    if (BB->size() > IGC_GET_FLAG_VALUE(LoopLoadPipeliningMaxInsts))
+        return false;
+
+    for (auto& I : *BB)
+    {
+        if (I.mayWriteToMemory() || I.mayHaveSideEffects())
+            return false;
+    }
+    return true;
+}
+
+bool LoopLoadPipelining::isCandidateLoad(Instruction* I) const
+{
+    if (I->use_empty())
+        return false;
+
+    if (auto* LD = dyn_cast<LoadInst>(I))
+    {
+        if (!LD->isSimple())
+            return false;
+    }
+    else if (!isa<LdRawIntrinsic>(I) && !isa<SamplerLoadIntrinsic>(I))
+    {
+        return false;
+    }
+
+    // Loop-invariant loads are left to LICM.
+    for (Value* Op : I->operands())
+    {
+        auto* OpI = dyn_cast<Instruction>(Op);
+        if (OpI && CurLoop->contains(OpI))
+            return true;
+    }
+    return false;
+}
+
+// Collect the loop instructions V is computed from. Fails if the computation
+// involves memory, side effects, or values that may not be recomputed for
+// the next iteration, or is too deep. Header phis are the leaves.
+bool LoopLoadPipelining::collectChain(Value* V, SetVector<Instruction*>& Chain,
+                                      unsigned Depth) const
+{
+    auto* I = dyn_cast<Instruction>(V);
+    if (!I || !CurLoop->contains(I) || isa<PHINode>(I) || Chain.count(I))
+        return true;
+
+    if (Depth > MAX_CHAIN_DEPTH || I->isTerminator() ||
+        I->mayReadFromMemory() || !isSafeToSpeculativelyExecute(I))
+        return false;
+
+    for (Value* Op : I->operands())
+    {
+        if (!collectChain(Op, Chain, Depth + 1))
+            return false;
+    }
+    Chain.insert(I);
+    return true;
+}
+
+// Move the instructions of Chain to the top of the header, keeping their
+// order. They only depend on phis, loop invariants and each other.
+void LoopLoadPipelining::moveToTop(const SetVector<Instruction*>& Chain)
+{
+    Instruction* Pos = &*Header->getFirstInsertionPt();
+    for (auto& I : make_early_inc_range(*Header))
+    {
+        if (!Chain.count(&I))
+            continue;
+        if (&I == Pos)
+        {
+            Pos = I.getNextNode();
+            continue;
+        }
+        I.moveBefore(Pos);
+    }
+    InsertPt = Pos;
+}
+
+// Return the value V has in the iteration entered from From, that is with
+// every header phi replaced by its incoming value from From. Computations
+// that differ are cloned at the builder's insertion point.
+Value* LoopLoadPipelining::getValueIn(Value* V, BasicBlock* From, IRBuilder<>& B,
+                                      DenseMap<Value*, Value*>& Map) const
+{
+    auto* I = dyn_cast<Instruction>(V);
+    if (!I || !CurLoop->contains(I))
+        return V;
+    if (auto* PN = dyn_cast<PHINode>(I))
+        return PN->getIncomingValueForBlock(From);
+
+    auto It = Map.find(I);
+    if (It != Map.end())
+        return It->second;
+
+    SmallVector<Value*, 4> Ops;
+    bool Same = true;
+    for (Value* Op : I->operands())
+    {
+        Ops.push_back(getValueIn(Op, From, B, Map));
+        Same &= Ops.back() == Op;
+    }
+
+    // Within the loop, a value that does not depend on the phis is the same
+    // in every iteration.
+    Value* Res = I;
+    if (!Same || From != Header)
+    {
+        Instruction* Clone = I->clone();
+        for (unsigned i = 0, e = Ops.size(); i != e; ++i)
+            Clone->setOperand(i, Ops[i]);
+        Res = B.Insert(Clone, I->getName() + (From == Header ? ".next" : ".first"));
+    }
+    Map[I] = Res;
+    return Res;
+}
+
+bool LoopLoadPipelining::pipelineLoad(Instruction* I)
+{
+    auto* BI = cast<BranchInst>(Header->getTerminator());
+    Value* Cond = BI->getCondition();
+
+    // Everything the load address and the trip decision depend on must be
+    // computable at the top of the iteration.
+    SetVector<Instruction*> Chain;
+    SetVector<Instruction*> OperandChain;
+    for (Value* Op : I->operands())
+    {
+        if (!collectChain(Op, OperandChain, 0))
+            return false;
+    }
+    SmallPtrSet<PHINode*, 8> Phis;
+    auto notePhi = [&](Value* V) {
+        if (auto* PN = dyn_cast<PHINode>(V))
+            if (PN->getParent() == Header)
+                Phis.insert(PN);
+    };
+    for (Value* Op : I->operands())
+        notePhi(Op);
+    for (Instruction* CI : OperandChain)
+        for (Value* Op : CI->operands())
+            notePhi(Op);
+
+    if (!collectChain(Cond, Chain, 0))
+        return false;
+    for (PHINode* PN : Phis)
+    {
+        if (!collectChain(PN->getIncomingValueForBlock(Header), Chain, 0))
+            return false;
+    }
+    Chain.insert(OperandChain.begin(), OperandChain.end());
+    moveToTop(Chain);
+
+    // Iteration 0 is loaded in the preheader.
+    IRBuilder<> PB(Preheader->getTerminator());
+    DenseMap<Value*, Value*> FirstMap;
+    Instruction* First = I->clone();
+    for (unsigned i = 0, e = I->getNumOperands(); i != e; ++i)
+        First->setOperand(i, getValueIn(I->getOperand(i), Preheader, PB, FirstMap));
+    PB.Insert(First, I->getName() + ".first");
+
+    // Iteration i loads for iteration i+1. On the last iteration the current
+    // operands are used again so that no new address is accessed.
+    IRBuilder<> B(InsertPt);
+    DenseMap<Value*, Value*> NextMap;
+    bool StayOnTrue = BI->getSuccessor(0) == Header;
+    Instruction* Next = I->clone();
+    for (unsigned i = 0, e = I->getNumOperands(); i != e; ++i)
+    {
+        Value* Cur = I->getOperand(i);
+        Value* NextOp = getValueIn(Cur, Header, B, NextMap);
+        if (NextOp == Cur)
+            continue;
+        Value* Safe = StayOnTrue ? B.CreateSelect(Cond, NextOp, Cur)
+                                 : B.CreateSelect(Cond, Cur, NextOp);
+        Next->setOperand(i, Safe);
+    }
+    B.Insert(Next, I->getName() + ".next");
+
+    PHINode* PN = PHINode::Create(I->getType(), 2, I->getName() + ".pipe",
+                                  &Header->front());
+    PN->addIncoming(First, Preheader);
+    PN->addIncoming(Next, Header);
+    I->replaceAllUsesWith(PN);
+    PN->takeName(I);
+    I->eraseFromParent();
+    return true;
+}
+
+bool LoopLoadPipelining::pipelineLoop(Loop* L, unsigned Pressure)
+{
+    CurLoop = L;
+    Header = L->getHeader();
+    Preheader = L->getLoopPreheader();
+
+    SmallVector<Instruction*, 8> Candidates;
+    for (auto& I : *Header)
+    {
+        if (isCandidateLoad(&I))
+            Candidates.push_back(&I);
+    }
+
+    bool Changed = false;
+    unsigned NumPipelined = 0;
+    const unsigned MaxLoads = IGC_GET_FLAG_VALUE(LoopLoadPipeliningMaxLoads);
+    for (Instruction* I : Candidates)
+    {
+        if (NumPipelined >= MaxLoads)
+            break;
+
+        // Both the value of the current and of the next iteration are live
+        // across the body.
+        unsigned Size = (unsigned)DL->getTypeAllocSize(I->getType());
+        unsigned Extra = WI->isUniform(I) ? Size : Size * SimdSize;
+        if (Pressure + Extra > Budget)
+            continue;
+
+        if (pipelineLoad(I))
+        {
+            Pressure += Extra;
+            ++NumPipelined;
+            Changed = true;
+        }
+    }
+    return Changed;
+}
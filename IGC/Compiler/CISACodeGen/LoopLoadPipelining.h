@@ -0,0 +1,28 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2023 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#ifndef _CISA_LOOPLOADPIPELINING_H_
+#define _CISA_LOOPLOADPIPELINING_H_
+
+#include "common/LLVMWarningsPush.hpp"
+#include <llvm/Pass.h>
+#include "common/LLVMWarningsPop.hpp"
+
+namespace IGC {
+    // Software-pipelines loads in innermost single-block counted loops by one
+    // iteration: the load of iteration i+1 is issued at the top of iteration
+    // i and reaches its uses through a header phi, so its latency overlaps
+    // with the ALU work of iteration i. Iteration 0 is loaded in the
+    // preheader. On the last iteration the load re-reads the address of the
+    // current iteration, so no access outside the original ones is made.
+    // Gated by the RegisterPressureEstimate of the loop body.
+    llvm::FunctionPass* createLoopLoadPipeliningPass();
+    void initializeLoopLoadPipeliningPass(llvm::PassRegistry&);
+} // End namespace IGC
+
+#endif // _CISA_LOOPLOADPIPELINING_H_
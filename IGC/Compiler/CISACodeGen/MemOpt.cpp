@@ -15,10 +15,13 @@ SPDX-License-Identifier: MIT
 #include <llvm/Analysis/AliasAnalysis.h>
 #include "llvm/Analysis/AliasSetTracker.h"
 #include <llvm/Analysis/InstructionSimplify.h>
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/Analysis/PostDominators.h>
 #include <llvm/Analysis/ScalarEvolution.h>
 #include <llvm/Analysis/ScalarEvolutionExpressions.h>
 #include <llvm/Analysis/ValueTracking.h>
 #include <llvm/IR/DataLayout.h>
+#include <llvm/IR/Dominators.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/GetElementPtrTypeIterator.h>
 #include <llvm/IR/GlobalAlias.h>
@@ -68,11 +71,17 @@ namespace {
     //   the non-tailing store is merged into the tailing one, iff there's no
     //   memory dependency between them which may results in different result.
     //
+    // With EnableMemOptCrossBB, the scan window spans a region of
+    // control-equivalent blocks instead of a single BB. See collectRegion().
+    //
     class MemOpt : public FunctionPass {
         const DataLayout* DL;
         AliasAnalysis* AA;
         ScalarEvolution* SE;
         WIAnalysis* WI;
+        DominatorTree* DT;
+        PostDominatorTree* PDT;
+        LoopInfo* LI;
 
         CodeGenContext* CGC;
         TargetLibraryInfo* TLI;
@@ -90,12 +99,18 @@ namespace {
         typedef std::vector<std::pair<Instruction*, unsigned> > MemRefListTy;
         typedef std::vector<Instruction*> TrivialMemRefListTy;
 
+        // Blocks on the paths between two consecutive blocks of the current
+        // cross-BB region. Their memory references are not control equivalent
+        // to the region, so they are never merged; they only have to be
+        // checked for dependencies when reordering across them.
+        SmallPtrSet<const BasicBlock*, 8> BypassedBlocks;
+
     public:
         static char ID;
 
         MemOpt(bool AllowNegativeSymPtrsForLoad = false, bool AllowVector8LoadStore = false) :
             FunctionPass(ID), DL(nullptr), AA(nullptr), SE(nullptr), WI(nullptr),
-            CGC(nullptr), AllowNegativeSymPtrsForLoad(AllowNegativeSymPtrsForLoad),
+            DT(nullptr), PDT(nullptr), LI(nullptr), CGC(nullptr), AllowNegativeSymPtrsForLoad(AllowNegativeSymPtrsForLoad),
             AllowVector8LoadStore(AllowVector8LoadStore)
         {
             initializeMemOptPass(*PassRegistry::getPassRegistry());
@@ -112,10 +127,23 @@ namespace {
             AU.addRequired<TargetLibraryInfoWrapperPass>();
             AU.addRequired<ScalarEvolutionWrapperPass>();
             AU.addRequired<WIAnalysis>();
+            if (IGC_IS_FLAG_ENABLED(EnableMemOptCrossBB)) {
+                AU.addRequired<DominatorTreeWrapperPass>();
+                AU.addRequired<PostDominatorTreeWrapperPass>();
+                AU.addRequired<LoopInfoWrapperPass>();
+            }
         }
 
         void buildProfitVectorLengths(Function& F);
 
+        void collectRegion(BasicBlock* Head,
+            SmallVectorImpl<BasicBlock*>& Region,
+            SmallPtrSetImpl<BasicBlock*>& RegionMembers);
+
+        bool isBypassedRef(const Instruction* I) const {
+            return BypassedBlocks.count(I->getParent()) != 0;
+        }
+
         bool mergeLoad(LoadInst* LeadingLoad, MemRefListTy::iterator MI,
             MemRefListTy& MemRefs, TrivialMemRefListTy& ToOpt);
         bool mergeStore(StoreInst* LeadingStore, MemRefListTy::iterator MI,
@@ -427,6 +455,9 @@ IGC_INITIALIZE_PASS_DEPENDENCY(MetaDataUtilsWrapper)
 IGC_INITIALIZE_PASS_DEPENDENCY(AAResultsWrapperPass)
 IGC_INITIALIZE_PASS_DEPENDENCY(TargetLibraryInfoWrapperPass)
 IGC_INITIALIZE_PASS_DEPENDENCY(WIAnalysis)
+IGC_INITIALIZE_PASS_DEPENDENCY(DominatorTreeWrapperPass)
+IGC_INITIALIZE_PASS_DEPENDENCY(PostDominatorTreeWrapperPass)
+IGC_INITIALIZE_PASS_DEPENDENCY(LoopInfoWrapperPass)
 IGC_INITIALIZE_PASS_END(MemOpt, PASS_FLAG, PASS_DESC, PASS_CFG_ONLY, PASS_ANALYSIS)
 
 char MemOpt::ID = 0;
@@ -477,6 +508,13 @@ bool MemOpt::runOnFunction(Function& F) {
     CGC = getAnalysis<CodeGenContextWrapper>().getCodeGenContext();
     TLI = &getAnalysis<TargetLibraryInfoWrapperPass>().getTLI();
 
+    const bool CrossBB = IGC_IS_FLAG_ENABLED(EnableMemOptCrossBB);
+    if (CrossBB) {
+        DT = &getAnalysis<DominatorTreeWrapperPass>().getDomTree();
+        PDT = &getAnalysis<PostDominatorTreeWrapperPass>().getPostDomTree();
+        LI = &getAnalysis<LoopInfoWrapperPass>().getLoopInfo();
+    }
+
     if (ProfitVectorLengths.empty())
         buildProfitVectorLengths(F);
 
@@ -485,26 +523,41 @@ bool MemOpt::runOnFunction(Function& F) {
     IGC::IGCMD::FunctionInfoMetaDataHandle funcInfoMD = MDU->getFunctionsInfoItem(&F);
     unsigned SimdSize = funcInfoMD->getSubGroupSize()->getSIMD_size();
 
+    // Blocks already scanned as a non-leading part of a cross-BB region.
+    SmallPtrSet<BasicBlock*, 16> RegionMembers;
+
     for (Function::iterator BB = F.begin(), BBE = F.end(); BB != BBE; ++BB) {
+        if (RegionMembers.count(&*BB))
+            continue;
+
+        SmallVector<BasicBlock*, 8> Region;
+        BypassedBlocks.clear();
+        if (CrossBB)
+            collectRegion(&*BB, Region, RegionMembers);
+        else
+            Region.push_back(&*BB);
+
         // Find all instructions with memory reference. Remember the distance one
         // by one.
         MemRefListTy MemRefs;
         TrivialMemRefListTy MemRefsToOptimize;
         unsigned Distance = 0;
-        for (auto BI = BB->begin(), BE = BB->end(); BI != BE; ++BI, ++Distance) {
-            Instruction* I = &(*BI);
+        for (BasicBlock* RBB : Region) {
+            for (auto BI = RBB->begin(), BE = RBB->end(); BI != BE; ++BI, ++Distance) {
+                Instruction* I = &(*BI);
+
+                // Make sure we don't count debug info intrinsincs
+                // This is required to keep debug and non-debug optimizations identical
+                if (isDbgIntrinsic(I)) {
+                    Distance--;
+                    continue;
+                }
 
-            // Make sure we don't count debug info intrinsincs
-            // This is required to keep debug and non-debug optimizations identical
-            if (isDbgIntrinsic(I)) {
-                Distance--;
-                continue;
+                // Skip irrelevant instructions.
+                if (shouldSkip(I))
+                    continue;
+                MemRefs.push_back(std::make_pair(I, Distance));
             }
-
-            // Skip irrelevant instructions.
-            if (shouldSkip(I))
-                continue;
-            MemRefs.push_back(std::make_pair(I, Distance));
         }
 
         // Skip BB with no more than 2 loads/stores.
@@ -519,12 +572,13 @@ bool MemOpt::runOnFunction(Function& F) {
         for (auto MI = MemRefs.begin(), ME = MemRefs.end(); MI != ME; ++MI) {
             Instruction* I = MI->first;
 
-            // Skip already merged one.
-            if (!I)
+            // Skip already merged one and references only kept for the
+            // dependency check.
+            if (!I || isBypassedRef(I))
                 continue;
 
-            if (LoadInst * LI = dyn_cast<LoadInst>(I))
-                Changed |= mergeLoad(LI, MI, MemRefs, MemRefsToOptimize);
+            if (LoadInst * LD = dyn_cast<LoadInst>(I))
+                Changed |= mergeLoad(LD, MI, MemRefs, MemRefsToOptimize);
             else if (StoreInst * SI = dyn_cast<StoreInst>(I))
                 Changed |= mergeStore(SI, MI, MemRefs, MemRefsToOptimize);
             else if (EnableRemoveRedBlockreads) {
@@ -542,13 +596,76 @@ bool MemOpt::runOnFunction(Function& F) {
             Changed |= optimizeGEP64(I);
     }
 
+    BypassedBlocks.clear();
     DL = nullptr;
     AA = nullptr;
     SE = nullptr;
+    DT = nullptr;
+    PDT = nullptr;
+    LI = nullptr;
 
     return Changed;
 }
 
+/// collectRegion() - collects the chain of blocks starting from Head where
+/// each block is immediately post-dominated by the next one, dominates it and
+/// lives in the same loop, i.e. all of them execute exactly as often as Head
+/// (for example the head and join of an if/else diamond, or consecutive
+/// pieces of an unrolled loop body.) Loads in such blocks may be hoisted to,
+/// and stores sunk to, any other block of the chain without speculation.
+///
+/// Blocks lying between two consecutive chain blocks are inserted into Region
+/// in between them and recorded in BypassedBlocks, so that their memory
+/// references still serialize merging across them through AA.
+void MemOpt::collectRegion(BasicBlock* Head,
+    SmallVectorImpl<BasicBlock*>& Region,
+    SmallPtrSetImpl<BasicBlock*>& RegionMembers) {
+    Region.push_back(Head);
+
+    const unsigned Limit = IGC_GET_FLAG_VALUE(MemOptWindowSize);
+    unsigned NumInsts = Head->size();
+    for (BasicBlock* Cur = Head; NumInsts < Limit;) {
+        DomTreeNode* Node = PDT->getNode(Cur);
+        DomTreeNode* IPDom = Node ? Node->getIDom() : nullptr;
+        BasicBlock* Next = IPDom ? IPDom->getBlock() : nullptr;
+        // The virtual exit node has no block.
+        if (!Next || Next == Cur || !DT->dominates(Cur, Next) ||
+            LI->getLoopFor(Next) != LI->getLoopFor(Cur) ||
+            RegionMembers.count(Next))
+            break;
+
+        // Gather blocks reachable from Cur before reaching Next. As Cur
+        // dominates Next and Next post-dominates Cur, these are exactly the
+        // blocks executed in between.
+        SmallVector<BasicBlock*, 8> Bypassed;
+        SmallVector<BasicBlock*, 8> Worklist(succ_begin(Cur), succ_end(Cur));
+        SmallPtrSet<BasicBlock*, 8> Visited;
+        while (!Worklist.empty()) {
+            BasicBlock* BB = Worklist.pop_back_val();
+            if (BB == Next || !Visited.insert(BB).second)
+                continue;
+            Bypassed.push_back(BB);
+            NumInsts += BB->size();
+            Worklist.append(succ_begin(BB), succ_end(BB));
+        }
+        // Bail out if the blocks in between may also be entered other than
+        // through Cur, e.g. through an irreducible cycle back to Cur.
+        if (llvm::any_of(Bypassed, [&](BasicBlock* BB) {
+                return !DT->properlyDominates(Cur, BB);
+            }))
+            break;
+
+        for (BasicBlock* BB : Bypassed) {
+            BypassedBlocks.insert(BB);
+            Region.push_back(BB);
+        }
+        Region.push_back(Next);
+        RegionMembers.insert(Next);
+        NumInsts += Next->size();
+        Cur = Next;
+    }
+}
+
 //This function removes redundant blockread instructions
 //if they read from addresses with the same base.
 //It replaces redundant blockread with a set of shuffle instructions.
@@ -603,6 +720,11 @@ bool MemOpt::removeRedBlockRead(GenIntrinsicInst* LeadingBlockRead,
             continue;
         }
 
+        // Redundant blockreads are only removed within a single BB.
+        if (NextMemRef->getParent() != LeadingBlockRead->getParent()) {
+            break;
+        }
+
         if (GenIntrinsicInst* GInst = dyn_cast<GenIntrinsicInst>(NextMemRef)) {
             if (GInst->getIntrinsicID() == GenISAIntrinsic::GenISA_simdBlockRead) {
                 Type* GInstType = GInst->getType();
@@ -1082,6 +1204,11 @@ bool MemOpt::mergeLoad(LoadInst* LeadingLoad,
 
         CheckList.push_back(NextMemRef);
 
+        // References from bypassed blocks only take part in the dependency
+        // check.
+        if (isBypassedRef(NextMemRef))
+            continue;
+
         LoadInst* NextLoad = dyn_cast<LoadInst>(NextMemRef);
 
         // Skip non-load instruction.
@@ -1427,6 +1554,11 @@ bool MemOpt::mergeStore(StoreInst* LeadingStore,
 
         CheckList.push_back(NextMemRef);
 
+        // References from bypassed blocks only take part in the dependency
+        // check.
+        if (isBypassedRef(NextMemRef))
+            continue;
+
         StoreInst* NextStore = dyn_cast<StoreInst>(NextMemRef);
         // Skip non-store instruction.
         if (!NextStore)
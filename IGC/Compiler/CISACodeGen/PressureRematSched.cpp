@@ -0,0 +1,376 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2023 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#include "Compiler/CISACodeGen/PressureRematSched.h"
+#include "Compiler/CISACodeGen/RegisterPressureEstimate.hpp"
+#include "Compiler/CISACodeGen/WIAnalysis.hpp"
+#include "Compiler/CodeGenContextWrapper.hpp"
+#include "Compiler/CodeGenPublic.h"
+#include "Compiler/IGCPassSupport.h"
+#include "common/debug/Debug.hpp"
+#include "common/igc_regkeys.hpp"
+#include "common/LLVMWarningsPush.hpp"
+#include "llvm/ADT/MapVector.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/IR/Dominators.h"
+#include "llvm/IR/Instructions.h"
+#include "common/LLVMWarningsPop.hpp"
+#include "Probe/Assertion.h"
+
+using namespace llvm;
+using namespace IGC;
+using namespace IGC::Debug;
+
+namespace {
+
+// Minimal distance (in instructions) between a def and a use, or between a
+// load and its first use, for a transformation to be considered.
+constexpr unsigned MIN_DISTANCE = 8;
+
+class PressureRematSched : public FunctionPass {
+public:
+    static char ID;
+
+    PressureRematSched() : FunctionPass(ID)
+    {
+        initializePressureRematSchedPass(*PassRegistry::getPassRegistry());
+    }
+
+    StringRef getPassName() const override { return "PressureRematSched"; }
+
+    void getAnalysisUsage(AnalysisUsage& AU) const override
+    {
+        AU.setPreservesCFG();
+        AU.addRequired<CodeGenContextWrapper>();
+        AU.addRequired<DominatorTreeWrapperPass>();
+        AU.addRequired<LoopInfoWrapperPass>();
+        AU.addRequired<WIAnalysis>();
+        AU.addRequired<RegisterPressureEstimate>();
+    }
+
+    bool runOnFunction(Function& F) override;
+
+private:
+    // Snapshot the estimate; return true if some point exceeds the budget.
+    bool computePressure(Function& F);
+    // Whether any program point in [Begin, End) exceeds the budget.
+    bool isHot(unsigned Begin, unsigned End) const;
+    // Whether V may be used at At without extending any live range.
+    bool isAvailableAt(Value* V, Instruction* At) const;
+    bool isRematCandidate(Instruction* I) const;
+
+    bool rematerialize(Function& F);
+    bool sinkLoads(Function& F);
+
+    RegisterPressureEstimate* RPE = nullptr;
+    WIAnalysis* WI = nullptr;
+    DominatorTree* DT = nullptr;
+    LoopInfo* LI = nullptr;
+
+    unsigned SimdSize = 16;
+    unsigned Budget = 0;
+    unsigned MaxPressure = 0;
+
+    // Instruction numbering of the current estimate. Instructions created
+    // during a round are not numbered and are skipped until the next round.
+    DenseMap<Instruction*, unsigned> Numbers;
+    // HotPrefix[N] is the number of hot program points before N.
+    std::vector<unsigned> HotPrefix;
+
+    unsigned NumRemat = 0;
+    unsigned NumSunkLoads = 0;
+};
+
+} // end namespace
+
+FunctionPass* IGC::createPressureRematSchedPass()
+{
+    return new PressureRematSched();
+}
+
+char PressureRematSched::ID = 0;
+
+#define PASS_FLAG     "igc-pressure-remat-sched"
+#define PASS_DESC     "Register pressure driven remat and scheduling"
+#define PASS_CFG_ONLY false
+#define PASS_ANALYSIS false
+namespace IGC {
+IGC_INITIALIZE_PASS_BEGIN(PressureRematSched, PASS_FLAG, PASS_DESC, PASS_CFG_ONLY, PASS_ANALYSIS)
+IGC_INITIALIZE_PASS_DEPENDENCY(CodeGenContextWrapper)
+IGC_INITIALIZE_PASS_DEPENDENCY(DominatorTreeWrapperPass)
+IGC_INITIALIZE_PASS_DEPENDENCY(LoopInfoWrapperPass)
+IGC_INITIALIZE_PASS_DEPENDENCY(WIAnalysis)
+IGC_INITIALIZE_PASS_DEPENDENCY(RegisterPressureEstimate)
+IGC_INITIALIZE_PASS_END(PressureRematSched, PASS_FLAG, PASS_DESC, PASS_CFG_ONLY, PASS_ANALYSIS)
+}
+
+bool PressureRematSched::runOnFunction(Function& F)
+{
+    CodeGenContext* pCtx = getAnalysis<CodeGenContextWrapper>().getCodeGenContext();
+    RPE = &getAnalysis<RegisterPressureEstimate>();
+    WI = &getAnalysis<WIAnalysis>();
+    DT = &getAnalysis<DominatorTreeWrapperPass>().getDomTree();
+    LI = &getAnalysis<LoopInfoWrapperPass>().getLoopInfo();
+
+    SimdSize = IGC_GET_FLAG_VALUE(PressureRematSchedSIMD);
+    Budget = IGC_GET_FLAG_VALUE(PressureRematSchedBudget);
+    if (Budget == 0)
+    {
+        Budget = pCtx->getNumGRFPerThread() * pCtx->platform.getGRFSize();
+    }
+    NumRemat = 0;
+    NumSunkLoads = 0;
+
+    bool Changed = false;
+    unsigned InitialPressure = 0;
+    const unsigned MaxIter = IGC_GET_FLAG_VALUE(PressureRematSchedMaxIter);
+    for (unsigned Iter = 0; Iter < MaxIter; ++Iter)
+    {
+        if (!RPE->isAvailable())
+            break;
+        bool OverBudget = computePressure(F);
+        if (Iter == 0)
+            InitialPressure = MaxPressure;
+        if (!OverBudget)
+            break;
+
+        bool Modified = rematerialize(F);
+        Modified |= sinkLoads(F);
+        if (!Modified)
+            break;
+
+        Changed = true;
+        RPE->buildLiveIntervals(true);
+        if (Iter + 1 == MaxIter && RPE->isAvailable())
+            computePressure(F);
+    }
+
+    if (IGC_IS_FLAG_ENABLED(DumpPressureRematSched))
+    {
+        ods() << "PressureRematSched: " << F.getName()
+              << " SIMD" << SimdSize << " budget " << Budget
+              << " bytes, max pressure " << InitialPressure
+              << " -> " << MaxPressure << " bytes, " << NumRemat
+              << " remat, " << NumSunkLoads << " sunk loads\n";
+    }
+    return Changed;
+}
+
+bool PressureRematSched::computePressure(Function& F)
+{
+    Numbers.clear();
+    for (auto& BB : F)
+    {
+        for (auto& I : BB)
+        {
+            if (!isa<DbgInfoIntrinsic>(&I))
+                Numbers[&I] = RPE->getAssignedNumberForInst(&I);
+        }
+    }
+
+    RPE->buildRPMapPerInstruction();
+    unsigned MaxNumber = RPE->getMaxAssignedNumberForFunction();
+    HotPrefix.assign(MaxNumber + 1, 0);
+    MaxPressure = 0;
+    for (unsigned N = 0; N < MaxNumber; ++N)
+    {
+        // The estimate is in bytes per lane for non-uniform values.
+        unsigned P = RPE->getRegisterPressureForInstructionFromRPMap(N) * SimdSize;
+        MaxPressure = std::max(MaxPressure, P);
+        HotPrefix[N + 1] = HotPrefix[N] + (P > Budget ? 1 : 0);
+    }
+    return MaxPressure > Budget;
+}
+
+bool PressureRematSched::isHot(unsigned Begin, unsigned End) const
+{
+    if (End > HotPrefix.size() - 1)
+        End = (unsigned)HotPrefix.size() - 1;
+    if (Begin >= End)
+        return false;
+    return HotPrefix[End] - HotPrefix[Begin] > 0;
+}
+
+bool PressureRematSched::isAvailableAt(Value* V, Instruction* At) const
+{
+    if (isa<Constant>(V) || isa<Argument>(V))
+        return true;
+
+    auto* I = dyn_cast<Instruction>(V);
+    if (!I || !DT->dominates(I, At))
+        return false;
+
+    auto It = Numbers.find(At);
+    RegisterPressureEstimate::LiveRange* LR = RPE->getLiveRangeOrNull(V);
+    if (It == Numbers.end() || !LR || It->second == 0)
+        return false;
+    // Live just before At means reusing V there extends nothing.
+    return LR->contains(It->second - 1) || LR->contains(It->second);
+}
+
+bool PressureRematSched::isRematCandidate(Instruction* I) const
+{
+    if (I->getType()->isIntegerTy(1) || I->mayHaveSideEffects() ||
+        I->mayReadFromMemory())
+        return false;
+
+    if (auto* BO = dyn_cast<BinaryOperator>(I))
+    {
+        switch (BO->getOpcode())
+        {
+        case Instruction::UDiv:
+        case Instruction::SDiv:
+        case Instruction::URem:
+        case Instruction::SRem:
+        case Instruction::FDiv:
+        case Instruction::FRem:
+            return false;
+        default:
+            return true;
+        }
+    }
+    return isa<CastInst>(I) || isa<GetElementPtrInst>(I);
+}
+
+// Clone cheap values whose live range crosses a hot region right before
+// their uses, once per user block. Uses in deeper loops are left alone so
+// that the dynamic instruction count does not grow.
+bool PressureRematSched::rematerialize(Function& F)
+{
+    bool Changed = false;
+    SmallVector<Instruction*, 64> Candidates;
+    for (auto& BB : F)
+    {
+        for (auto& I : BB)
+        {
+            if (isRematCandidate(&I) && !I.use_empty())
+                Candidates.push_back(&I);
+        }
+    }
+
+    for (Instruction* I : Candidates)
+    {
+        auto DefIt = Numbers.find(I);
+        if (DefIt == Numbers.end())
+            continue;
+        unsigned DefN = DefIt->second;
+
+        MapVector<BasicBlock*, SmallVector<Use*, 4>> UsesByBB;
+        for (Use& U : I->uses())
+        {
+            auto* UI = cast<Instruction>(U.getUser());
+            auto UseIt = Numbers.find(UI);
+            if (isa<PHINode>(UI) || UseIt == Numbers.end())
+                continue;
+            unsigned UseN = UseIt->second;
+            if (UseN <= DefN + MIN_DISTANCE || !isHot(DefN + 1, UseN))
+                continue;
+            BasicBlock* UseBB = UI->getParent();
+            if (LI->getLoopDepth(UseBB) > LI->getLoopDepth(I->getParent()))
+                continue;
+            bool OpsAvailable = llvm::all_of(I->operands(),
+                [&](Value* Op) { return isAvailableAt(Op, UI); });
+            if (!OpsAvailable)
+                continue;
+            UsesByBB[UseBB].push_back(&U);
+        }
+
+        for (auto& Item : UsesByBB)
+        {
+            // Insert before the earliest user in that block.
+            Instruction* InsertPt = nullptr;
+            for (Use* U : Item.second)
+            {
+                auto* UI = cast<Instruction>(U->getUser());
+                if (!InsertPt || Numbers[UI] < Numbers[InsertPt])
+                    InsertPt = UI;
+            }
+            Instruction* Clone = I->clone();
+            Clone->setName(I->getName() + ".remat");
+            Clone->insertBefore(InsertPt);
+            WI->incUpdateDepend(Clone, WI->whichDepend(I));
+            for (Use* U : Item.second)
+                U->set(Clone);
+            ++NumRemat;
+            Changed = true;
+        }
+
+        if (I->use_empty())
+        {
+            Numbers.erase(I);
+            I->eraseFromParent();
+        }
+    }
+    return Changed;
+}
+
+// Within a block, move a load whose result sits unused across a hot region
+// down to its first use. Nothing that may write memory is crossed.
+bool PressureRematSched::sinkLoads(Function& F)
+{
+    bool Changed = false;
+    for (auto& BB : F)
+    {
+        SmallVector<LoadInst*, 16> Loads;
+        for (auto& I : BB)
+        {
+            if (auto* LD = dyn_cast<LoadInst>(&I))
+            {
+                if (LD->isSimple() && Numbers.count(LD))
+                    Loads.push_back(LD);
+            }
+        }
+
+        for (LoadInst* LD : Loads)
+        {
+            Instruction* Target = nullptr;
+            bool HasPHIUse = false;
+            for (User* U : LD->users())
+            {
+                auto* UI = cast<Instruction>(U);
+                if (UI->getParent() != &BB)
+                    continue;
+                if (isa<PHINode>(UI) || !Numbers.count(UI))
+                {
+                    HasPHIUse = true;
+                    break;
+                }
+                if (!Target || Numbers[UI] < Numbers[Target])
+                    Target = UI;
+            }
+            if (HasPHIUse)
+                continue;
+            if (!Target)
+                Target = BB.getTerminator();
+
+            unsigned LdN = Numbers[LD];
+            unsigned TargetN = Numbers[Target];
+            if (TargetN <= LdN + MIN_DISTANCE || !isHot(LdN + 1, TargetN))
+                continue;
+            if (!isAvailableAt(LD->getPointerOperand(), Target))
+                continue;
+
+            bool Blocked = false;
+            for (auto It = std::next(LD->getIterator()); &*It != Target; ++It)
+            {
+                if (It->mayWriteToMemory() || It->mayHaveSideEffects())
+                {
+                    Blocked = true;
+                    break;
+                }
+            }
+            if (Blocked)
+                continue;
+
+            LD->moveBefore(Target);
+            ++NumSunkLoads;
+            Changed = true;
+        }
+    }
+    return Changed;
+}
@@ -0,0 +1,26 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2023 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#ifndef _CISA_PRESSUREREMATSCHED_H_
+#define _CISA_PRESSUREREMATSCHED_H_
+
+#include "common/LLVMWarningsPush.hpp"
+#include <llvm/Pass.h>
+#include "common/LLVMWarningsPop.hpp"
+
+namespace IGC {
+    // Uses RegisterPressureEstimate to find program points whose estimated
+    // pressure at the target SIMD width exceeds the GRF budget, and lowers
+    // pressure there by rematerializing cheap values near their uses and
+    // sinking long-lived loads towards their first use. Estimation and
+    // transformation are iterated until the function fits or nothing changes.
+    llvm::FunctionPass* createPressureRematSchedPass();
+    void initializePressureRematSchedPass(llvm::PassRegistry&);
+} // End namespace IGC
+
+#endif // _CISA_PRESSUREREMATSCHED_H_
@@ -36,6 +36,8 @@ SPDX-License-Identifier: MIT
 #include "Compiler/CISACodeGen/MemOpt2.h"
 #include "Compiler/CISACodeGen/PreRARematFlag.h"
 #include "Compiler/CISACodeGen/PreRAScheduler.hpp"
+#include "Compiler/CISACodeGen/PressureRematSched.h"
+#include "Compiler/CISACodeGen/LoopLoadPipelining.h"
 #include "Compiler/CISACodeGen/PromoteConstantStructs.hpp"
 #include "Compiler/Optimizer/OpenCLPasses/GenericAddressResolution/GASResolving.h"
 #include "Compiler/CISACodeGen/ResolvePredefinedConstant.h"
@@ -234,6 +236,16 @@ void AddAnalysisPasses(CodeGenContext& ctx, IGCPassManager& mpm)
         IGC_IS_FLAG_ENABLED(EnablePreRARematFlag)) {
         mpm.add(createPreRARematFlagPass());
     }
+    // Lower estimated register pressure by remat and load sinking, after
+    // code sinking so the estimate is close to what gets emitted.
+    if (!isOptDisabled && IGC_IS_FLAG_ENABLED(EnablePressureRematSched)) {
+        mpm.add(createPressureRematSchedPass());
+    }
+    // Overlap load latency with the loop body where the pressure left after
+    // rematerialization allows it.
+    if (!isOptDisabled && IGC_IS_FLAG_ENABLED(EnableLoopLoadPipelining)) {
+        mpm.add(createLoopLoadPipeliningPass());
+    }
     // Peephole framework for generic type legalization
     mpm.add(new Legalizer::PeepholeTypeLegalizer());
     if (IGC_IS_FLAG_ENABLED(ForcePromoteI8) ||
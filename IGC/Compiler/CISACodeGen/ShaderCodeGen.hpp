@@ -431,6 +431,9 @@ public:
 
     /// Initialize per function status.
     void BeginFunction(llvm::Function* F);
+    /// Print the uniform scalar packing statistics of function F
+    /// (see PackUniformScalars).
+    void ReportUniformScalarPacking(llvm::Function* F) const;
     // This method split payload interpolations from the shader into another compilation unit
     void SplitPayloadFromShader(llvm::Function* F);
     /// This method is used to create the vISA variable for function F's formal return value
@@ -648,6 +651,14 @@ private:
     CVariable* GetSymbolFromSource(llvm::Instruction* UseInst,
         e_alignment preferredAlign);
 
+    // Return an alias into a shared GRF-sized variable if value is a
+    // long-lived uniform scalar that can be packed, and nullptr otherwise.
+    CVariable* GetPackedUniformScalar(llvm::Value* value,
+        e_alignment preferredAlign);
+    bool IsPackableUniformScalar(llvm::Value* value);
+    void PlanUniformScalarPacking(llvm::Function* F);
+    void ResetUniformScalarPacking();
+
 protected:
     CShaderProgram* m_parent;
     CodeGenContext* m_ctx;
@@ -762,6 +773,21 @@ protected:
 
     uint32_t m_NumSampleBallotLoops = 0;
 
+    // Uniform scalar packing state (per function). Each group of scalars
+    // with the same live range has a pack: var is the GRF currently being
+    // filled and offset is the first free byte in it.
+    struct UniformPack {
+        CVariable* var = nullptr;
+        uint32_t offset = 0;
+    };
+    llvm::DenseMap<llvm::Value*, unsigned> m_UniformPackGroup;
+    std::vector<UniformPack> m_UniformPacks;
+    bool m_UniformPackPlanned = false;
+    uint32_t m_NumUnpackedUniformScalars = 0;
+    uint32_t m_NumPackedUniformScalars = 0;
+    uint32_t m_NumUniformPackGRFs = 0;
+    uint32_t m_UniformPackedBytes = 0;
+
     DebugInfoData diData;
 
     // Shader has LSC store messages with non-default L1 cache control
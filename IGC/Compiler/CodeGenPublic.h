@@ -85,6 +85,7 @@ namespace IGCOpts
 namespace IGC
 {
     class CodeGenContext;
+    class VISADebugInfo;
 
     struct SProgramOutput
     {
@@ -120,8 +121,14 @@ namespace IGC
         // are not really needed, consider removal
         void* m_debugDataGenISA = nullptr;          //<! GenISA debug data (VISA -> GenISA)
         unsigned int    m_debugDataGenISASize = 0;      //<! Number of bytes of GenISA debug data
+        std::shared_ptr<IGC::VISADebugInfo> m_VISADebugInfo; //<! GenISA debug data handed over by vISA without serialization
         unsigned int    m_InstructionCount = 0;
         unsigned int    m_BasicBlockCount = 0;
+        unsigned int    m_estCycles = 0;            //<! static throughput estimate, loop weighted cycles per thread
+        unsigned int    m_estALUCycles = 0;
+        unsigned int    m_estSendCycles = 0;
+        unsigned int    m_estSyncCycles = 0;
+        unsigned char   m_estBottleneck = 0;        //<! vISA::PERF_BOTTLENECK of the estimate
         void* m_gtpinBuffer = nullptr;              // Will be populated by VISA only when special switch is passed by gtpin
         unsigned int    m_gtpinBufferSize = 0;
         FuncGTPinInfoListTy m_FuncGTPinInfoList;
@@ -174,6 +181,7 @@ namespace IGC
             {
                 IGC::aligned_free(m_debugDataGenISA);
             }
+            m_VISADebugInfo.reset();
             if (m_funcAttributeTable)
             {
                 IGC::aligned_free(m_funcAttributeTable);
@@ -331,64 +331,72 @@ std::unique_ptr<llvm::Module> BIImport::Construct(Module& M, CLElfLib::CElfReade
     unsigned numOfHeaders = pElfReader->GetElfHeader()->NumSectionHeaderEntries;
     std::vector<std::unique_ptr<llvm::Module>> elf_index(numOfHeaders);
 
-    std::function<void(Function*)> Explore = [&](Function* pRoot) -> void
+    // Materializes the builtins reachable from pRoot. Callees are visited with
+    // an explicit worklist since builtin call chains can be deep.
+    SmallVector<Function*, 32> Worklist;
+    auto Explore = [&](Function* pRoot) -> void
     {
-        TFunctionsVec calledFuncs;
-        GetCalledFunctions(pRoot, calledFuncs);
-
-        for (auto* pCallee : calledFuncs)
+        Worklist.push_back(pRoot);
+        while (!Worklist.empty())
         {
-            Function* pFunc = nullptr;
-            if (pCallee->isDeclaration())
+            Function* pCurrent = Worklist.pop_back_val();
+            TFunctionsVec calledFuncs;
+            GetCalledFunctions(pCurrent, calledFuncs);
+
+            for (auto* pCallee : calledFuncs)
             {
-                auto funcName = pCallee->getName();
-                if (funcName.str() == "__enqueue_kernel_basic" ||
-                    funcName.str() == "__enqueue_kernel_vaargs" ||
-                    funcName.str() == "__enqueue_kernel_events_vaargs" ||
-                    funcName.str() == "_Z14enqueue_kernel")
-                {
-                    funcName = StringRef("enqueue_IB_kernel");
-                }
-                int SectionIndex = Map[funcName];
-                if (SectionIndex == 0 || pCallee->isIntrinsic()) continue;
-                if (elf_index[SectionIndex] == NULL)
+                Function* pFunc = nullptr;
+                if (pCallee->isDeclaration())
                 {
-                    char* pData_Func = NULL;
-                    size_t SectionSize = 0;
-                    pElfReader->GetSectionData(SectionIndex, pData_Func, SectionSize);
-                    std::unique_ptr<MemoryBuffer> OutputBuffer =
-                        MemoryBuffer::getMemBufferCopy(
-                            StringRef(pData_Func, SectionSize));
-                    llvm::Expected<std::unique_ptr<llvm::Module>> ModuleOrErr =
-                        getOwningLazyBitcodeModule(std::move(OutputBuffer), M.getContext());
-                    if (llvm::Error EC = ModuleOrErr.takeError())
+                    auto funcName = pCallee->getName();
+                    if (funcName.str() == "__enqueue_kernel_basic" ||
+                        funcName.str() == "__enqueue_kernel_vaargs" ||
+                        funcName.str() == "__enqueue_kernel_events_vaargs" ||
+                        funcName.str() == "_Z14enqueue_kernel")
                     {
-                        IGC_ASSERT_MESSAGE(0, "Error linking generic builtin module");
+                        funcName = StringRef("enqueue_IB_kernel");
                     }
-                    elf_index[SectionIndex] = (std::move(*ModuleOrErr));
+                    int SectionIndex = Map[funcName];
+                    if (SectionIndex == 0 || pCallee->isIntrinsic()) continue;
+                    if (elf_index[SectionIndex] == NULL)
+                    {
+                        char* pData_Func = NULL;
+                        size_t SectionSize = 0;
+                        pElfReader->GetSectionData(SectionIndex, pData_Func, SectionSize);
+                        std::unique_ptr<MemoryBuffer> OutputBuffer =
+                            MemoryBuffer::getMemBufferCopy(
+                                StringRef(pData_Func, SectionSize));
+                        llvm::Expected<std::unique_ptr<llvm::Module>> ModuleOrErr =
+                            getOwningLazyBitcodeModule(std::move(OutputBuffer), M.getContext());
+                        if (llvm::Error EC = ModuleOrErr.takeError())
+                        {
+                            IGC_ASSERT_MESSAGE(0, "Error linking generic builtin module");
+                        }
+                        elf_index[SectionIndex] = (std::move(*ModuleOrErr));
+                    }
+                    auto Generic = elf_index[SectionIndex].get();
+                    Function* pSrcFunc = GetBuiltinFunction(funcName, Generic);
+                    pFunc = pSrcFunc;
+                    if (!pFunc) continue;
                 }
-                auto Generic = elf_index[SectionIndex].get();
-                Function* pSrcFunc = GetBuiltinFunction(funcName, Generic);
-                pFunc = pSrcFunc;
-                if (!pFunc) continue;
-            }
-            else
-            {
-                pFunc = pCallee;
-            }
-
-            if (pFunc->isMaterializable())
-            {
-                if (Error Err = pFunc->materialize()) {
-                    std::string Msg;
-                    handleAllErrors(std::move(Err), [&](ErrorInfoBase& EIB) {
-                        errs() << "===> Materialize Failure: " << EIB.message().c_str() << '\n';
-                    });
-                    IGC_ASSERT_MESSAGE(0, "Failed to materialize Global Variables");
+                else
+                {
+                    pFunc = pCallee;
                 }
-                else {
-                    pFunc->addFnAttr("OclBuiltin");
-                    Explore(pFunc);
+
+                if (pFunc->isMaterializable())
+                {
+                    if (Error Err = pFunc->materialize()) {
+                        std::string Msg;
+                        handleAllErrors(std::move(Err), [&](ErrorInfoBase& EIB) {
+                            errs() << "===> Materialize Failure: " << EIB.message().c_str() << '\n';
+                        });
+                        IGC_ASSERT_MESSAGE(0, "Failed to materialize Global Variables");
+                    }
+                    else {
+                        pFunc->addFnAttr("OclBuiltin");
+                        Worklist.push_back(pFunc);
+                    }
                 }
             }
         }
@@ -629,9 +637,23 @@ bool BIImport::runOnModule(Module& M)
         }
     }
 
-    std::function<void(Function*)> Explore = [&](Function* pRoot) -> void
+    // Materialize exactly the call closure of the kernel module in the lazily
+    // loaded builtin modules; bodies of builtins nobody calls are never read.
+    // Each builtin is scanned once, right after it is materialized, so a
+    // worklist is enough (and avoids deep recursion on long call chains).
+    TFunctionsVec worklist;
+    for (auto& func : M)
+    {
+        worklist.push_back(&func);
+    }
+
+    TFunctionsVec calledFuncs;
+    while (!worklist.empty())
     {
-        TFunctionsVec calledFuncs;
+        Function* pRoot = worklist.back();
+        worklist.pop_back();
+
+        calledFuncs.clear();
         GetCalledFunctions(pRoot, calledFuncs);
 
         for (auto* pCallee : calledFuncs)
@@ -660,7 +682,7 @@ bool BIImport::runOnModule(Module& M)
                 }
                 else {
                     pFunc->addFnAttr("OclBuiltin");
-                    Explore(pFunc);
+                    worklist.push_back(pFunc);
                 }
             }
 
@@ -670,11 +692,6 @@ bool BIImport::runOnModule(Module& M)
                 pFunc->addFnAttr("KMPLOCK");
             }
         }
-    };
-
-    for (auto& func : M)
-    {
-        Explore(&func);
     }
 
     // nuke the unused functions so we can materializeAll() quickly
@@ -0,0 +1,61 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2024 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+; REQUIRES: regkeys
+; RUN: igc_opt -regkey ControlKernelCompileTime=1 -regkey KernelCompileTimeBudget=0 -regkey ControlInlineTinySize=0 \
+; RUN:   -regkey PrintKernelCompileTimeBudget=3 --EstimateFunctionSize -S < %s 2>&1 | FileCheck %s
+; ------------------------------------------------
+; EstimateFunctionSize: compile time budget
+; ------------------------------------------------
+
+; foo is inlined twice, so trimming it is the only way to lower the cost of
+; test_budget. bar is inlined once and is kept.
+
+; CHECK: KernelCompileTimeBudget0x1: Kernel / Unit test_budget expSize= {{[0-9]+}} cost= {{[0-9]+}} > 0
+; CHECK-DAG: KernelCompileTimeBudget0x2: Trim foo size contribution: {{[0-9]+}} cost [[BEFORE:[0-9]+]] -> {{[0-9]+}}
+; CHECK-DAG: KernelCompileTimeBudget0x2: Keep inlining bar (single inlined copy)
+; CHECK: KernelCompileTimeBudget0x1: Kernel / Unit test_budget final cost {{[0-9]+}} reduced from [[BEFORE]] (still over budget)
+
+define spir_kernel void @test_budget(i32* %s) {
+entry:
+  %0 = call spir_func i32 @foo(i32* %s)
+  %1 = call spir_func i32 @foo(i32* %s)
+  %2 = call spir_func i32 @bar(i32 %0)
+  %3 = add i32 %1, %2
+  store i32 %3, i32* %s, align 4
+  ret void
+}
+
+define spir_func i32 @foo(i32* %a) {
+entry:
+  %0 = load i32, i32* %a, align 4
+  %1 = icmp slt i32 %0, 16
+  br i1 %1, label %then, label %end
+
+then:                                             ; preds = %entry
+  %2 = mul i32 %0, %0
+  br label %end
+
+end:                                              ; preds = %then, %entry
+  %3 = phi i32 [ %0, %entry ], [ %2, %then ]
+  ret i32 %3
+}
+
+define spir_func i32 @bar(i32 %x) {
+entry:
+  %0 = add i32 %x, 1
+  ret i32 %0
+}
+
+!igc.functions = !{!0, !3, !5}
+!0 = !{void (i32*)* @test_budget, !1}
+!1 = !{!2}
+!2 = !{!"function_type", i32 0}
+!3 = !{i32 (i32*)* @foo, !4}
+!4 = !{!6}
+!5 = !{i32 (i32)* @bar, !4}
+!6 = !{!"function_type", i32 2}
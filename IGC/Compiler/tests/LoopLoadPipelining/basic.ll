@@ -0,0 +1,81 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2023 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+;
+; RUN: igc_opt -igc-loop-load-pipelining -S < %s | FileCheck %s
+; ------------------------------------------------
+; LoopLoadPipelining
+; ------------------------------------------------
+
+; The load of the first iteration is issued in the preheader, and every
+; iteration loads for the next one. The last iteration re-reads its own
+; address instead of the one past the end.
+
+define void @test(float addrspace(1)* %p, float addrspace(1)* %out, i32 %n) {
+; CHECK-LABEL: @test(
+; CHECK:  entry:
+; CHECK-NEXT:    [[GEP0:%.*]] = getelementptr float, float addrspace(1)* %p, i32 0
+; CHECK-NEXT:    [[V0:%.*]] = load float, float addrspace(1)* [[GEP0]]
+; CHECK-NEXT:    br label %loop
+; CHECK:  loop:
+; CHECK-NEXT:    [[V:%.*]] = phi float [ [[V0]], %entry ], [ [[VN:%.*]], %loop ]
+; CHECK-NEXT:    [[I:%.*]] = phi i32
+; CHECK-NEXT:    [[ACC:%.*]] = phi float
+; CHECK-NEXT:    [[GEP:%.*]] = getelementptr float, float addrspace(1)* %p, i32 [[I]]
+; CHECK-NEXT:    [[INEXT:%.*]] = add i32 [[I]], 1
+; CHECK-NEXT:    [[CMP:%.*]] = icmp slt i32 [[INEXT]], %n
+; CHECK-NEXT:    [[GEPN:%.*]] = getelementptr float, float addrspace(1)* %p, i32 [[INEXT]]
+; CHECK-NEXT:    [[SEL:%.*]] = select i1 [[CMP]], float addrspace(1)* [[GEPN]], float addrspace(1)* [[GEP]]
+; CHECK-NEXT:    [[VN]] = load float, float addrspace(1)* [[SEL]]
+; CHECK-NEXT:    [[ACCN:%.*]] = fadd float [[ACC]], [[V]]
+; CHECK-NEXT:    br i1 [[CMP]], label %loop, label %exit
+;
+entry:
+  br label %loop
+
+loop:
+  %i = phi i32 [ 0, %entry ], [ %i.next, %loop ]
+  %acc = phi float [ 0.0, %entry ], [ %acc.next, %loop ]
+  %gep = getelementptr float, float addrspace(1)* %p, i32 %i
+  %v = load float, float addrspace(1)* %gep
+  %acc.next = fadd float %acc, %v
+  %i.next = add i32 %i, 1
+  %cmp = icmp slt i32 %i.next, %n
+  br i1 %cmp, label %loop, label %exit
+
+exit:
+  store float %acc.next, float addrspace(1)* %out
+  ret void
+}
+
+; Loops that write memory are left alone.
+
+define void @test_store(float addrspace(1)* %p, float addrspace(1)* %q, i32 %n) {
+; CHECK-LABEL: @test_store(
+; CHECK:  entry:
+; CHECK-NEXT:    br label %loop
+; CHECK:  loop:
+; CHECK-NEXT:    [[I:%.*]] = phi i32
+; CHECK-NEXT:    [[GEP:%.*]] = getelementptr float, float addrspace(1)* %p, i32 [[I]]
+; CHECK-NEXT:    [[V:%.*]] = load float, float addrspace(1)* [[GEP]]
+;
+entry:
+  br label %loop
+
+loop:
+  %i = phi i32 [ 0, %entry ], [ %i.next, %loop ]
+  %gep = getelementptr float, float addrspace(1)* %p, i32 %i
+  %v = load float, float addrspace(1)* %gep
+  %gepq = getelementptr float, float addrspace(1)* %q, i32 %i
+  store float %v, float addrspace(1)* %gepq
+  %i.next = add i32 %i, 1
+  %cmp = icmp slt i32 %i.next, %n
+  br i1 %cmp, label %loop, label %exit
+
+exit:
+  ret void
+}
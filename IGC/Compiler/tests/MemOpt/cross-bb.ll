@@ -0,0 +1,100 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2023 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+
+; REQUIRES: regkeys
+; RUN: igc_opt -regkey EnableMemOptCrossBB=1 %s -S -o - %enable-basic-aa% -igc-memopt | FileCheck %s
+
+target datalayout = "e-p:32:32:32-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f16:16:16-f32:32:32-f64:64:64-f80:128:128-v16:16:16-v24:32:32-v32:32:32-v48:64:64-v64:64:64-v96:128:128-v128:128:128-v192:256:256-v512:512:512-v1024:1024:1024-a:64:64-f80:128:128-n8:16:32:64"
+
+; The load in the join block of the diamond is control equivalent to the one
+; in the entry block and nothing in between may write %src.
+
+define void @f0(i32 addrspace(1)* noalias %dst, i32 addrspace(1)* noalias %src, i1 %c) {
+entry:
+  %0 = load i32, i32 addrspace(1)* %src, align 4
+  br i1 %c, label %then, label %join
+
+then:
+  store i32 %0, i32 addrspace(1)* %dst, align 4
+  br label %join
+
+join:
+  %arrayidx1 = getelementptr inbounds i32, i32 addrspace(1)* %src, i64 1
+  %1 = load i32, i32 addrspace(1)* %arrayidx1, align 4
+  %arrayidx2 = getelementptr inbounds i32, i32 addrspace(1)* %dst, i64 1
+  store i32 %1, i32 addrspace(1)* %arrayidx2, align 4
+  ret void
+}
+
+; CHECK-LABEL: define void @f0
+; CHECK: entry:
+; CHECK: load <2 x i32>
+; CHECK: then:
+; CHECK: join:
+; CHECK-NOT: load
+; CHECK: ret void
+
+; The store in the bypassed block may alias %src, so the loads are kept apart.
+
+define void @f1(i32 addrspace(1)* %dst, i32 addrspace(1)* noalias %src, i1 %c) {
+entry:
+  %0 = load i32, i32 addrspace(1)* %src, align 4
+  br i1 %c, label %then, label %join
+
+then:
+  store i32 %0, i32 addrspace(1)* %dst, align 4
+  br label %join
+
+join:
+  %arrayidx1 = getelementptr inbounds i32, i32 addrspace(1)* %src, i64 1
+  %1 = load i32, i32 addrspace(1)* %arrayidx1, align 4
+  %arrayidx2 = getelementptr inbounds i32, i32 addrspace(1)* %dst, i64 1
+  store i32 %1, i32 addrspace(1)* %arrayidx2, align 4
+  ret void
+}
+
+; CHECK-LABEL: define void @f1
+; CHECK: entry:
+; CHECK: load i32, i32 addrspace(1)* %src
+; CHECK: join:
+; CHECK: load i32, i32 addrspace(1)* %arrayidx1
+
+; Loads from the conditional block are not control equivalent to the entry
+; block and must not be hoisted.
+
+define void @f2(i32 addrspace(1)* noalias %dst, i32 addrspace(1)* noalias %src, i1 %c) {
+entry:
+  %0 = load i32, i32 addrspace(1)* %src, align 4
+  store i32 %0, i32 addrspace(1)* %dst, align 4
+  br i1 %c, label %then, label %exit
+
+then:
+  %arrayidx1 = getelementptr inbounds i32, i32 addrspace(1)* %src, i64 1
+  %1 = load i32, i32 addrspace(1)* %arrayidx1, align 4
+  %arrayidx2 = getelementptr inbounds i32, i32 addrspace(1)* %dst, i64 1
+  store i32 %1, i32 addrspace(1)* %arrayidx2, align 4
+  br label %exit
+
+exit:
+  ret void
+}
+
+; CHECK-LABEL: define void @f2
+; CHECK: entry:
+; CHECK: load i32, i32 addrspace(1)* %src
+; CHECK: then:
+; CHECK: load i32, i32 addrspace(1)* %arrayidx1
+
+!igc.functions = !{!0, !3, !4}
+
+!0 = !{void (i32 addrspace(1)*, i32 addrspace(1)*, i1)* @f0, !1}
+!3 = !{void (i32 addrspace(1)*, i32 addrspace(1)*, i1)* @f1, !1}
+!4 = !{void (i32 addrspace(1)*, i32 addrspace(1)*, i1)* @f2, !1}
+
+!1 = !{!2}
+!2 = !{!"function_type", i32 0}
@@ -0,0 +1,70 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2023 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+;
+; RUN: igc_opt -regkey PressureRematSchedBudget=1 -igc-pressure-remat-sched -S < %s | FileCheck %s
+; ------------------------------------------------
+; PressureRematSched
+; ------------------------------------------------
+
+; With a budget that every program point exceeds, the cheap %add is
+; rematerialized next to its only use and the load is sunk to its first use.
+
+define void @test(i32 addrspace(1)* %p, i32 %a, i32 %b) {
+; CHECK-LABEL: @test(
+; CHECK:  entry:
+; CHECK-NEXT:    [[X1:%.*]] = mul i32 %a, 3
+; CHECK:         [[X9:%.*]] = mul i32 {{%.*}}, 11
+; CHECK-NEXT:    [[V:%.*]] = load i32, i32 addrspace(1)* %p
+; CHECK-NEXT:    [[S:%.*]] = add i32 [[X9]], [[V]]
+; CHECK-NEXT:    [[ADD:%.*]] = add i32 %a, %b
+; CHECK-NEXT:    [[R:%.*]] = add i32 [[S]], [[ADD]]
+; CHECK-NEXT:    store i32 [[R]], i32 addrspace(1)* %p
+; CHECK-NEXT:    ret void
+;
+entry:
+  %add = add i32 %a, %b
+  %v = load i32, i32 addrspace(1)* %p
+  %x1 = mul i32 %a, 3
+  %x2 = mul i32 %x1, 4
+  %x3 = mul i32 %x2, 5
+  %x4 = mul i32 %x3, 6
+  %x5 = mul i32 %x4, 7
+  %x6 = mul i32 %x5, 8
+  %x7 = mul i32 %x6, 9
+  %x8 = mul i32 %x7, 10
+  %x9 = mul i32 %x8, 11
+  %s = add i32 %x9, %v
+  %r = add i32 %s, %add
+  store i32 %r, i32 addrspace(1)* %p
+  ret void
+}
+
+; A load is not moved across a store.
+
+define void @test_store(i32 addrspace(1)* %p, i32 addrspace(1)* %q, i32 %a) {
+; CHECK-LABEL: @test_store(
+; CHECK:  entry:
+; CHECK-NEXT:    [[V:%.*]] = load i32, i32 addrspace(1)* %p
+; CHECK-NEXT:    store i32 %a, i32 addrspace(1)* %q
+;
+entry:
+  %v = load i32, i32 addrspace(1)* %p
+  store i32 %a, i32 addrspace(1)* %q
+  %x1 = mul i32 %a, 3
+  %x2 = mul i32 %x1, 4
+  %x3 = mul i32 %x2, 5
+  %x4 = mul i32 %x3, 6
+  %x5 = mul i32 %x4, 7
+  %x6 = mul i32 %x5, 8
+  %x7 = mul i32 %x6, 9
+  %x8 = mul i32 %x7, 10
+  %x9 = mul i32 %x8, 11
+  %s = add i32 %x9, %v
+  store i32 %s, i32 addrspace(1)* %p
+  ret void
+}
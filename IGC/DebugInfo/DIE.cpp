@@ -343,6 +343,9 @@ unsigned DIELabel::SizeOf(StreamEmitter *AP, dwarf::Form Form) const {
     return 4;
   if (Form == dwarf::DW_FORM_strp)
     return 4;
+  // DWARF 32-bit format, see DIEEntry::getRefAddrSize.
+  if (Form == dwarf::DW_FORM_ref_addr)
+    return 4;
   return AP->GetPointerSize();
 }
 
@@ -778,6 +778,16 @@ void CompileUnit::addType(DIE *Entity, DIType *Ty, dwarf::Attribute Attribute) {
     return;
   }
 
+  // Refer to the DIE another kernel of the program emitted, unless this
+  // kernel already has its own.
+  if (!getDIE(Ty)) {
+    if (MCSymbol *Shared = DD->getSharedTypeSymbol(Ty)) {
+      Entity->addValue(Attribute, dwarf::DW_FORM_ref_addr,
+                       new (DIEValueAllocator) DIELabel(Shared));
+      return;
+    }
+  }
+
   // Construct type.
   DIE *Buffer = getOrCreateTypeDIE(Ty);
 
@@ -3223,7 +3233,10 @@ void CompileUnit::emitHeader(const MCSection *ASection,
     Asm->EmitInt8(Asm->GetPointerSize());
   }
   // Emit ("Offset Into Abbrev. Section");
-  if (EmitSettings.EnableRelocation)
+  if (const MCSymbol *SharedAbbrevs = DD->getSharedAbbrevTableSym())
+    // Table shared by the kernels of the program, see DwarfTypePool.
+    Asm->EmitLabelReference(SharedAbbrevs, 4);
+  else if (EmitSettings.EnableRelocation)
     // Emit 4-byte offset since we're using DWARF4 32-bit format
     Asm->EmitLabelReference(
         Asm->GetTempSymbol(
@@ -404,9 +404,99 @@ DwarfDISubprogramCache::findNodes(const std::vector<Function *> &Functions) {
   }
   return Result;
 }
+
+unsigned DwarfTypePool::beginUnit() {
+  UnitReusedTypes.clear();
+  return Stats.Units++;
+}
+
+void DwarfTypePool::endUnit(uint64_t InfoBytes) {
+  Stats.InfoBytesEmitted += InfoBytes;
+  Stats.ReusedTypes += UnitReusedTypes.size();
+  // A type nested in another reused type was not emitted either way, do not
+  // count it twice.
+  for (unsigned Idx : UnitReusedTypes) {
+    bool Nested = false;
+    for (int P = Types[Idx].Parent; P >= 0 && !Nested; P = Types[P].Parent)
+      Nested = UnitReusedTypes.count(P);
+    if (!Nested)
+      Stats.TypeBytesSaved += Types[Idx].Size;
+  }
+  UnitReusedTypes.clear();
+}
+
+StringRef DwarfTypePool::getTypeSymbol(const MDNode *Ty) {
+  auto It = TypeIndex.find(Ty);
+  if (It == TypeIndex.end())
+    return StringRef();
+  ++Stats.TypeReferences;
+  UnitReusedTypes.insert(It->second);
+  return Types[It->second].Symbol;
+}
+
+void DwarfTypePool::addType(const MDNode *Ty, const std::string &Symbol,
+                            unsigned Size, const MDNode *Parent) {
+  IGC_ASSERT(!hasType(Ty));
+  int ParentIdx = Parent ? (int)TypeIndex.lookup(Parent) : -1;
+  IGC_ASSERT(!Parent || hasType(Parent));
+  TypeIndex[Ty] = Types.size();
+  Types.push_back(TypeEntry{Symbol, Size, ParentIdx});
+  ++Stats.ExportedTypes;
+}
+
+unsigned DwarfTypePool::getAbbrevNumber(const DIEAbbrev &Abbrev) {
+  FoldingSetNodeID ID;
+  Abbrev.Profile(ID);
+  void *InsertPos = nullptr;
+  if (DIEAbbrev *InSet = AbbreviationsSet.FindNodeOrInsertPos(ID, InsertPos))
+    return InSet->getNumber();
+
+  // The abbreviation of a DIE dies with the DIE, keep a copy.
+  DIEAbbrev &Copy =
+      Abbreviations.emplace_back(Abbrev.getTag(), Abbrev.getChildrenFlag());
+  for (const DIEAbbrevData &Data : Abbrev.getData())
+    Copy.AddAttribute(Data.getAttribute(), Data.getForm());
+  Copy.setNumber(Abbreviations.size());
+  AbbreviationsSet.InsertNode(&Copy, InsertPos);
+  return Copy.getNumber();
+}
+
+void DwarfTypePool::setAbbrevTableSymbol(const std::string &Symbol) {
+  AbbrevTableSymbol = Symbol;
+  NumEmittedAbbrevs = Abbreviations.size();
+  ++Stats.AbbrevTablesEmitted;
+  // Same layout as DIEAbbrev::Emit plus the code of each abbreviation and
+  // the terminating zero.
+  uint64_t Bytes = 1;
+  for (const DIEAbbrev &Abbrev : Abbreviations) {
+    Bytes += getULEB128Size(Abbrev.getNumber()) +
+             getULEB128Size(Abbrev.getTag()) + 1;
+    for (const DIEAbbrevData &Data : Abbrev.getData())
+      Bytes += getULEB128Size(Data.getAttribute()) +
+               getULEB128Size(Data.getForm());
+    Bytes += 2;
+  }
+  Stats.AbbrevBytesEmitted += Bytes;
+}
+
+void DwarfTypePool::print(raw_ostream &OS) const {
+  OS << "Debug info shared between " << Stats.Units << " kernels:\n";
+  OS << "  .debug_info bytes emitted:     " << Stats.InfoBytesEmitted << "\n";
+  OS << "  type DIEs exported:            " << Stats.ExportedTypes << "\n";
+  OS << "  type DIEs reused:              " << Stats.ReusedTypes << "\n";
+  OS << "  type DIE bytes not re-emitted: " << Stats.TypeBytesSaved << "\n";
+  OS << "  cross-kernel type references:  " << Stats.TypeReferences << "\n";
+  OS << "  abbreviation tables emitted:   " << Stats.AbbrevTablesEmitted
+     << " (" << Stats.AbbrevBytesEmitted << " bytes, " << Abbreviations.size()
+     << " abbreviations)\n";
+  OS << "  abbreviation tables reused:    " << Stats.AbbrevTablesReused
+     << "\n";
+}
+
 DwarfDebug::DwarfDebug(StreamEmitter *A, VISAModule *M)
     : Asm(A), EmitSettings(Asm->GetEmitterSettings()), m_pModule(M),
-      DISPCache(nullptr), FirstCU(0),
+      DISPCache(nullptr), TypePool(nullptr), TypePoolUnit(0),
+      SharedAbbrevTableSym(nullptr), EmitsSharedAbbrevTable(false), FirstCU(0),
       // AbbreviationsSet(InitAbbreviationsSetSize),
       SourceIdMap(DIEValueAllocator), PrevLabel(nullptr), GlobalCUIndexCount(0),
       StringPool(DIEValueAllocator), NextStringPoolNumber(0),
@@ -483,6 +573,11 @@ VISAModule *DwarfDebug::GetVISAModule(const llvm::Function *F) const {
 // Define a unique number for the abbreviation.
 //
 void DwarfDebug::assignAbbrevNumber(IGC::DIEAbbrev &Abbrev) {
+  if (TypePool) {
+    Abbrev.setNumber(TypePool->getAbbrevNumber(Abbrev));
+    return;
+  }
+
   // Check the set for priors.
   DIEAbbrev *InSet = AbbreviationsSet.GetOrInsertNode(&Abbrev);
 
@@ -499,6 +594,91 @@ void DwarfDebug::assignAbbrevNumber(IGC::DIEAbbrev &Abbrev) {
   }
 }
 
+const DIEAbbrev *DwarfDebug::getAbbreviation(unsigned Number) const {
+  if (TypePool)
+    return &TypePool->getAbbrev(Number);
+  return Abbreviations[Number - 1];
+}
+
+void DwarfDebug::setTypePool(DwarfTypePool *Pool) {
+  // Shared DIEs are referred to through relocations with DW_FORM_ref_addr,
+  // which is only 4 bytes since DWARF 3.
+  if (!Pool || !EmitSettings.EnableRelocation || DwarfVersion < 3)
+    return;
+  TypePool = Pool;
+  TypePoolUnit = Pool->beginUnit();
+}
+
+MCSymbol *DwarfDebug::getSharedTypeSymbol(const MDNode *Ty) {
+  if (!TypePool)
+    return nullptr;
+  StringRef Symbol = TypePool->getTypeSymbol(Ty);
+  if (Symbol.empty())
+    return nullptr;
+  return Asm->GetGlobalSymbol(Symbol);
+}
+
+void DwarfDebug::exportTypeDIEs(
+    DIE *Die, const MDNode *Parent,
+    const DenseMap<const DIE *, const MDNode *> &DieToType,
+    unsigned &NumExported) {
+  switch (Die->getTag()) {
+  case dwarf::DW_TAG_subprogram:
+  case dwarf::DW_TAG_lexical_block:
+  case dwarf::DW_TAG_inlined_subroutine:
+    // Types local to a subprogram stay with it.
+    return;
+  case dwarf::DW_TAG_structure_type:
+  case dwarf::DW_TAG_class_type:
+  case dwarf::DW_TAG_union_type:
+  case dwarf::DW_TAG_enumeration_type: {
+    const MDNode *Ty = DieToType.lookup(Die);
+    if (!Ty || TypePool->hasType(Ty) ||
+        Die->getSize() < TypePool->getMinTypeSize() ||
+        Die->findAttribute(dwarf::DW_AT_declaration))
+      break;
+    std::string Symbol = ("__igc_dbg_type." + Twine(TypePoolUnit) + "." +
+                          Twine(NumExported++))
+                             .str();
+    TypePool->addType(Ty, Symbol, Die->getSize(), Parent);
+    ExportedTypeDIEs[Die] = Asm->GetGlobalSymbol(Symbol);
+    Parent = Ty;
+    break;
+  }
+  default:
+    break;
+  }
+
+  for (DIE *Child : Die->getChildren())
+    exportTypeDIEs(Child, Parent, DieToType, NumExported);
+}
+
+void DwarfDebug::exportToTypePool() {
+  if (!TypePool)
+    return;
+
+  DenseMap<const DIE *, const MDNode *> DieToType;
+  for (const auto &Entry : MDTypeNodeToDieMap)
+    if (isa<DIType>(Entry.first))
+      DieToType[Entry.second] = Entry.first;
+
+  // Walk the DIE trees so that the symbols are named in emission order.
+  unsigned NumExported = 0;
+  for (CompileUnit *CU : CUs)
+    exportTypeDIEs(CU->getCUDie(), nullptr, DieToType, NumExported);
+
+  if (TypePool->needsAbbrevTable()) {
+    std::string Symbol =
+        ("__igc_dbg_abbrev." + Twine(TypePoolUnit)).str();
+    TypePool->setAbbrevTableSymbol(Symbol);
+    EmitsSharedAbbrevTable = true;
+  } else {
+    TypePool->reuseAbbrevTable();
+  }
+  SharedAbbrevTableSym =
+      Asm->GetGlobalSymbol(TypePool->getAbbrevTableSymbol());
+}
+
 /// isSubprogramContext - Return true if Context is either a subprogram
 /// or another context nested inside a subprogram.
 bool DwarfDebug::isSubprogramContext(const MDNode *D) {
@@ -1366,6 +1546,9 @@ void DwarfDebug::endModule() {
   // Finalize the debug info for the module.
   finalizeModuleInfo();
 
+  // Share types and abbreviations with the other kernels of the program.
+  exportToTypePool();
+
   // Emit visible names into a debug str section.
   emitDebugStr();
 
@@ -1384,6 +1567,14 @@ void DwarfDebug::endModule() {
   // Emit info into a debug macinfo section.
   emitDebugMacInfo();
 
+  if (TypePool) {
+    uint64_t InfoBytes = 0;
+    for (CompileUnit *CU : CUs)
+      InfoBytes += sizeof(int32_t) + CU->getHeaderSize() +
+                   CU->getCUDie()->getSize();
+    TypePool->endUnit(InfoBytes);
+  }
+
   // clean up.
   SPMap.clear();
   for (DenseMap<const MDNode *, CompileUnit *>::iterator I = CUMap.begin(),
@@ -2483,7 +2674,7 @@ unsigned DwarfDebug::computeSizeAndOffset(DIE *Die, unsigned Offset) {
 
   // Get the abbreviation for this DIE.
   unsigned AbbrevNumber = Die->getAbbrevNumber();
-  const DIEAbbrev *Abbrev = Abbreviations[AbbrevNumber - 1];
+  const DIEAbbrev *Abbrev = getAbbreviation(AbbrevNumber);
 
   // Set DIE offset
   Die->setOffset(Offset);
@@ -2622,9 +2813,12 @@ void DwarfDebug::emitDebugStr() {
 
 // Recursively emits a debug information entry.
 void DwarfDebug::emitDIE(DIE *Die) {
+  if (MCSymbol *Sym = ExportedTypeDIEs.lookup(Die))
+    Asm->EmitGlobalLabel(Sym);
+
   // Get the abbreviation for this DIE.
   unsigned AbbrevNumber = Die->getAbbrevNumber();
-  const DIEAbbrev *Abbrev = Abbreviations[AbbrevNumber - 1];
+  const DIEAbbrev *Abbrev = getAbbreviation(AbbrevNumber);
 
   // Emit the code (index) for the abbreviation.
   Asm->EmitULEB128(AbbrevNumber);
@@ -2646,6 +2840,11 @@ void DwarfDebug::emitDIE(DIE *Die) {
     case dwarf::DW_AT_specification:
     case dwarf::DW_AT_import:
     case dwarf::DW_AT_containing_type: {
+      if (isa<DIELabel>(Values[i])) {
+        // DIE of another kernel, see DwarfTypePool.
+        Values[i]->EmitValue(Asm, Form);
+        break;
+      }
       DIE *Origin = cast<DIEEntry>(Values[i])->getEntry();
       unsigned Addr = Origin->getOffset();
       if (Form == dwarf::DW_FORM_ref_addr) {
@@ -2728,19 +2927,28 @@ void DwarfDebug::emitDebugInfo() {
 void DwarfDebug::emitAbbreviations() {
   const MCSection *Section = Asm->GetDwarfAbbrevSection();
 
+  // The CU headers refer to the table emitted by another kernel.
+  if (TypePool && !EmitsSharedAbbrevTable)
+    return;
+
+  unsigned NumAbbrevs =
+      TypePool ? TypePool->getNumAbbrevs() : Abbreviations.size();
+
   // Check to see if it is worth the effort.
-  if (!Abbreviations.empty()) {
+  if (NumAbbrevs) {
     // Start the debug abbrev section.
     Asm->SwitchSection(Section);
 
     MCSymbol *Begin = Asm->GetTempSymbol(
         /*Section->getLabelBeginName()*/ ".debug_abbrev_begin");
     Asm->EmitLabel(Begin);
+    if (TypePool)
+      Asm->EmitGlobalLabel(SharedAbbrevTableSym);
 
     // For each abbrevation.
-    for (unsigned i = 0, N = Abbreviations.size(); i < N; ++i) {
+    for (unsigned i = 0; i < NumAbbrevs; ++i) {
       // Get abbreviation data
-      const DIEAbbrev *Abbrev = Abbreviations.at(i);
+      const DIEAbbrev *Abbrev = getAbbreviation(i + 1);
 
       // Emit the abbrevations code (base 1 index.)
       Asm->EmitULEB128(Abbrev->getNumber(), "Abbreviation Code");
@@ -21,6 +21,7 @@ See LICENSE.TXT for details.
 // clang-format off
 #include "common/LLVMWarningsPush.hpp"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/FoldingSet.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/StringMap.h"
@@ -42,6 +43,7 @@ See LICENSE.TXT for details.
 #include "EmitterOpts.hpp"
 
 #include "Probe/Assertion.h"
+#include <deque>
 #include <set>
 
 namespace llvm {
@@ -273,6 +275,97 @@ public:
   DISubprogramNodes findNodes(const std::vector<llvm::Function *> &Functions);
 };
 
+// DwarfTypePool shares type DIEs and the abbreviation table between the
+// kernels of one program.
+// The debug ELF files of all kernels of a program are linked into a single
+// relocatable ELF before they are copied to zeBinary, so each kernel used to
+// carry its own copy of every type it references (most of it coming from
+// SYCL headers) and its own abbreviation table. With a pool:
+// I. The first kernel that emits the definition of a large enough composite
+//    type exports a global symbol at its DIE. Later kernels refer to that
+//    DIE with a DW_FORM_ref_addr relocation instead of building a copy.
+//    Type metadata is uniqued by LLVM, so within the module of the program
+//    a node identifies the type content. Types local to a subprogram are
+//    never shared.
+// II. Abbreviation numbers are assigned from one program-wide table. A
+//    kernel emits the table only when it adds abbreviations to it; otherwise
+//    its CU headers refer to the table emitted last.
+// Kernels must be emitted in a fixed order and all of them must end up in the
+// same linked ELF.
+class DwarfTypePool {
+public:
+  struct Statistics {
+    unsigned Units = 0;
+    unsigned ExportedTypes = 0;
+    unsigned ReusedTypes = 0;
+    unsigned TypeReferences = 0;
+    uint64_t TypeBytesSaved = 0;
+    unsigned AbbrevTablesEmitted = 0;
+    unsigned AbbrevTablesReused = 0;
+    uint64_t AbbrevBytesEmitted = 0;
+    uint64_t InfoBytesEmitted = 0;
+  };
+
+  // Each reference to a shared DIE costs a relocation, so DIEs smaller than
+  // MinTypeSize bytes (children included) are not shared.
+  explicit DwarfTypePool(unsigned MinTypeSize) : MinTypeSize(MinTypeSize) {}
+
+  unsigned getMinTypeSize() const { return MinTypeSize; }
+
+  /// Start a new kernel and return its number, used to name its symbols.
+  unsigned beginUnit();
+  /// Finish the current kernel, InfoBytes is the size of its .debug_info.
+  void endUnit(uint64_t InfoBytes);
+
+  bool hasType(const llvm::MDNode *Ty) const { return TypeIndex.count(Ty); }
+  /// Return the symbol of the shared DIE of Ty, or an empty string.
+  llvm::StringRef getTypeSymbol(const llvm::MDNode *Ty);
+  /// Record the DIE of Ty exported by the current kernel. Parent is the
+  /// closest exported type enclosing it, if any.
+  void addType(const llvm::MDNode *Ty, const std::string &Symbol,
+               unsigned Size, const llvm::MDNode *Parent);
+
+  /// Return the program-wide number of Abbrev, adding it if needed.
+  unsigned getAbbrevNumber(const DIEAbbrev &Abbrev);
+  const DIEAbbrev &getAbbrev(unsigned Number) const {
+    return Abbreviations[Number - 1];
+  }
+  unsigned getNumAbbrevs() const { return Abbreviations.size(); }
+
+  /// True if the current kernel has to emit the abbreviation table because
+  /// none was emitted yet or it added abbreviations.
+  bool needsAbbrevTable() const {
+    return AbbrevTableSymbol.empty() ||
+           Abbreviations.size() != NumEmittedAbbrevs;
+  }
+  const std::string &getAbbrevTableSymbol() const { return AbbrevTableSymbol; }
+  void setAbbrevTableSymbol(const std::string &Symbol);
+  void reuseAbbrevTable() { ++Stats.AbbrevTablesReused; }
+
+  const Statistics &getStatistics() const { return Stats; }
+  void print(llvm::raw_ostream &OS) const;
+
+private:
+  struct TypeEntry {
+    std::string Symbol;
+    unsigned Size;
+    int Parent;
+  };
+
+  unsigned MinTypeSize;
+  llvm::DenseMap<const llvm::MDNode *, unsigned> TypeIndex;
+  std::vector<TypeEntry> Types;
+  // Shared types referenced by the current kernel.
+  llvm::DenseSet<unsigned> UnitReusedTypes;
+
+  llvm::FoldingSet<DIEAbbrev> AbbreviationsSet;
+  std::deque<DIEAbbrev> Abbreviations;
+  std::string AbbrevTableSymbol;
+  unsigned NumEmittedAbbrevs = 0;
+
+  Statistics Stats;
+};
+
 /// \brief Collects and handles llvm::dwarf debug information.
 class DwarfDebug {
   // Target of Dwarf emission.
@@ -283,6 +376,15 @@ class DwarfDebug {
 
   DwarfDISubprogramCache *DISPCache;
 
+  // Type DIEs and abbreviations shared with the other kernels, if any.
+  DwarfTypePool *TypePool;
+  unsigned TypePoolUnit;
+  // Type DIEs of this kernel the other kernels can refer to.
+  llvm::DenseMap<const DIE *, llvm::MCSymbol *> ExportedTypeDIEs;
+  // Abbreviation table referenced by the CU headers when TypePool is set.
+  llvm::MCSymbol *SharedAbbrevTableSym;
+  bool EmitsSharedAbbrevTable;
+
   // All DIEValues are allocated through this allocator.
   llvm::BumpPtrAllocator DIEValueAllocator;
 
@@ -500,6 +602,14 @@ private:
   /// \brief Emit the abbreviation section.
   void emitAbbreviations();
 
+  /// \brief Export the type DIEs other kernels can refer to and pick the
+  /// abbreviation table, see DwarfTypePool.
+  void exportToTypePool();
+  void exportTypeDIEs(DIE *Die, const llvm::MDNode *Parent,
+                      const llvm::DenseMap<const DIE *, const llvm::MDNode *>
+                          &DieToType,
+                      unsigned &NumExported);
+
   /// \brief Emit visible names into a debug str section.
   void emitDebugStr();
 
@@ -570,6 +680,7 @@ private:
 
   /// \brief Define a unique number for the abbreviation.
   void assignAbbrevNumber(DIEAbbrev &Abbrev);
+  const DIEAbbrev *getAbbreviation(unsigned Number) const;
 
   void discoverDISPNodes(DwarfDISubprogramCache &Cache);
   void discoverDISPNodes();
@@ -586,6 +697,14 @@ public:
     return EmitSettings;
   }
   void setDISPCache(DwarfDISubprogramCache *Cache) { DISPCache = Cache; }
+  void setTypePool(DwarfTypePool *Pool);
+
+  /// \brief Return the symbol of the DIE another kernel emitted for Ty, or
+  /// null if this kernel has to emit its own.
+  llvm::MCSymbol *getSharedTypeSymbol(const llvm::MDNode *Ty);
+  const llvm::MCSymbol *getSharedAbbrevTableSym() const {
+    return SharedAbbrevTableSym;
+  }
 
   void insertDIE(const llvm::MDNode *TypeMD, DIE *Die) {
     MDTypeNodeToDieMap.insert(std::make_pair(TypeMD, Die));
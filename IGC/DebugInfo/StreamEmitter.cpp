@@ -521,6 +521,10 @@ MCSymbol *StreamEmitter::CreateTempSymbol() const {
   return m_pContext->createTempSymbol();
 }
 
+MCSymbol *StreamEmitter::GetGlobalSymbol(StringRef name) const {
+  return m_pContext->getOrCreateSymbol(name);
+}
+
 unsigned StreamEmitter::GetDwarfCompileUnitID() const {
   return m_pContext->getDwarfCompileUnitID();
 }
@@ -587,6 +591,15 @@ void StreamEmitter::EmitLabel(MCSymbol *pLabel) const {
 #endif
 }
 
+void StreamEmitter::EmitGlobalLabel(MCSymbol *pLabel) const {
+#if LLVM_VERSION_MAJOR <= 10
+  m_pMCStreamer->EmitSymbolAttribute(pLabel, MCSA_Global);
+#else
+  m_pMCStreamer->emitSymbolAttribute(pLabel, MCSA_Global);
+#endif
+  EmitLabel(pLabel);
+}
+
 void StreamEmitter::EmitLabelDifference(const MCSymbol *pHi,
                                         const MCSymbol *pLo,
                                         unsigned size) const {
@@ -107,6 +107,13 @@ public:
   /// @return Machine Code symbol
   llvm::MCSymbol *CreateTempSymbol() const;
 
+  /// @brief Return the symbol with the specified name. Unlike the temporary
+  ///        labels it is kept in the symbol table of the object, so other
+  ///        objects linked with this one can refer to it.
+  /// @param name symbol name
+  /// @return Machine Code symbol
+  llvm::MCSymbol *GetGlobalSymbol(llvm::StringRef name) const;
+
   /// @brief Dwarf CU getter & setter
   unsigned GetDwarfCompileUnitID() const;
   void SetDwarfCompileUnitID(unsigned cuIndex) const;
@@ -147,6 +154,9 @@ public:
   /// @brief Emit a label
   void EmitLabel(llvm::MCSymbol *pLabel) const;
 
+  /// @brief Emit a label that is visible to the objects linked with this one.
+  void EmitGlobalLabel(llvm::MCSymbol *pLabel) const;
+
   /// @brief Emit something like ".long pHi-pLo" where the size in bytes
   ///        of the directive is specified by size and pHi/pLo specify the
   ///        labels.  This implicitly uses .set if it is available.
@@ -208,3 +208,139 @@ void IGC::DbgDecoder::print(llvm::raw_ostream &OS) const {
 }
 
 void IGC::DbgDecoder::dump() const { print(llvm::dbgs()); }
+
+static IGC::DbgDecoder::VarAlloc
+makeVarAlloc(const vISA::DebugInfoLiveInterval &lr) {
+  IGC::DbgDecoder::VarAlloc data;
+  data.virtualType = (IGC::DbgDecoder::VarAlloc::VirtualVarType)lr.virtualType;
+  data.physicalType =
+      (IGC::DbgDecoder::VarAlloc::PhysicalVarType)lr.physicalType;
+
+  switch (data.physicalType) {
+  case IGC::DbgDecoder::VarAlloc::PhyTypeAddress:
+  case IGC::DbgDecoder::VarAlloc::PhyTypeFlag:
+  case IGC::DbgDecoder::VarAlloc::PhyTypeGRF:
+    data.mapping.r.regNum = lr.regNum;
+    data.mapping.r.subRegNum = lr.subRegNum;
+    break;
+  case IGC::DbgDecoder::VarAlloc::PhyTypeMemory:
+    IGC::DbgDecoder::setMappingMem(data.mapping, lr.memOffset);
+    break;
+  }
+  return data;
+}
+
+void IGC::DbgDecoderBuilder::beginCompiledObject(const char *name,
+                                                 uint32_t relocOffset) {
+  resetCursor();
+  Decoded.compiledObjs.emplace_back();
+  auto &f = current();
+  f.kernelName = name;
+  f.relocOffset = relocOffset;
+}
+
+void IGC::DbgDecoderBuilder::addCISAOffset(uint32_t cisaOffset,
+                                           uint32_t genOffset) {
+  auto &f = current();
+  f.CISAOffsetMap.emplace_back(cisaOffset, f.relocOffset + genOffset);
+}
+
+void IGC::DbgDecoderBuilder::addCISAIndex(uint32_t cisaIndex,
+                                          uint32_t genOffset) {
+  auto &f = current();
+  f.CISAIndexMap.emplace_back(cisaIndex, f.relocOffset + genOffset);
+}
+
+void IGC::DbgDecoderBuilder::beginVariable(const char *name) {
+  resetCursor();
+  auto &f = current();
+  f.Vars.emplace_back();
+  f.Vars.back().name = name;
+  VISAIntervals = &f.Vars.back().lrs;
+}
+
+void IGC::DbgDecoderBuilder::beginSubroutine(const char *name,
+                                             uint32_t startVISAIndex,
+                                             uint32_t endVISAIndex) {
+  resetCursor();
+  auto &f = current();
+  f.subs.emplace_back();
+  auto &sub = f.subs.back();
+  sub.name = name;
+  sub.startVISAIndex = startVISAIndex;
+  sub.endVISAIndex = endVISAIndex;
+  VISAIntervals = &sub.retval;
+}
+
+void IGC::DbgDecoderBuilder::setFrameSize(uint16_t frameSize) {
+  resetCursor();
+  current().cfi.frameSize = frameSize;
+}
+
+void IGC::DbgDecoderBuilder::beginFrameEntry(FrameEntry entry) {
+  resetCursor();
+  auto &cfi = current().cfi;
+  switch (entry) {
+  case FrameEntry::BEFP:
+    cfi.befpValid = true;
+    GenISAIntervals = &cfi.befp;
+    break;
+  case FrameEntry::CallerBEFP:
+    cfi.callerbefpValid = true;
+    GenISAIntervals = &cfi.callerbefp;
+    break;
+  case FrameEntry::RetAddr:
+    cfi.retAddrValid = true;
+    GenISAIntervals = &cfi.retAddr;
+    break;
+  }
+}
+
+void IGC::DbgDecoderBuilder::addLiveInterval(
+    const vISA::DebugInfoLiveInterval &lr) {
+  // Intervals over vISA indices are 16-bit in the binary format as well.
+  if (VISAIntervals) {
+    DbgDecoder::LiveIntervalsVISA lv;
+    lv.start = (uint16_t)lr.start;
+    lv.end = (uint16_t)lr.end;
+    lv.var = makeVarAlloc(lr);
+    VISAIntervals->push_back(lv);
+    return;
+  }
+  IGC_ASSERT_MESSAGE(GenISAIntervals, "live interval without an owner");
+  DbgDecoder::LiveIntervalGenISA lv;
+  lv.start = lr.start;
+  lv.end = lr.end;
+  lv.var = makeVarAlloc(lr);
+  GenISAIntervals->push_back(lv);
+}
+
+void IGC::DbgDecoderBuilder::beginRegSave(bool isCalleeSave,
+                                          uint32_t genIPOffset) {
+  resetCursor();
+  auto &cfi = current().cfi;
+  auto &entries = isCalleeSave ? cfi.calleeSaveEntry : cfi.callerSaveEntry;
+  auto &numEntries =
+      isCalleeSave ? cfi.numCalleeSaveEntries : cfi.numCallerSaveEntries;
+  entries.emplace_back();
+  ++numEntries;
+  RegSave = &entries.back();
+  RegSave->genIPOffset = genIPOffset;
+}
+
+void IGC::DbgDecoderBuilder::addRegSaveMapping(
+    const vISA::DebugInfoRegSaveMapping &mapping) {
+  IGC_ASSERT_MESSAGE(RegSave, "save/restore mapping without an owner");
+  DbgDecoder::RegInfoMapping info;
+  info.srcRegOff = mapping.srcRegOff;
+  info.numBytes = mapping.numBytes;
+  info.dstInReg = mapping.dstInReg;
+  if (info.dstInReg) {
+    info.dst.r.regNum = mapping.dstRegNum;
+    info.dst.r.subRegNum = 0;
+  } else {
+    DbgDecoder::setMappingMem(info.dst, mapping.dstMemOffset);
+  }
+  RegSave->data.push_back(info);
+  ++RegSave->numEntries;
+}
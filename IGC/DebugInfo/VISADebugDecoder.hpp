@@ -17,10 +17,12 @@ SPDX-License-Identifier: MIT
 // clang-format on
 
 #include "Probe/Assertion.h"
+#include "visa/include/VISADebugInfoSink.h"
 
 #include <algorithm>
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace IGC {
@@ -222,6 +224,12 @@ public:
 
   std::vector<DbgInfoFormat> compiledObjs;
 
+  // Memory mappings are stored as 31-bit offset + 1-bit base flag.
+  static void setMappingMem(DbgDecoder::Mapping &mapping, uint32_t data) {
+    mapping.m.memoryOffset = (data & 0x7fffffff);
+    mapping.m.isBaseOffBEFP = (data & 0x80000000);
+  }
+
 private:
   void readMappingReg(DbgDecoder::Mapping &mapping) {
     mapping.r.regNum = read<uint16_t>(dbg);
@@ -229,9 +237,7 @@ private:
   }
 
   void readMappingMem(DbgDecoder::Mapping &mapping) {
-    uint32_t temp = read<uint32_t>(dbg);
-    mapping.m.memoryOffset = (temp & 0x7fffffff);
-    mapping.m.isBaseOffBEFP = (temp & 0x80000000);
+    setMappingMem(mapping, read<uint32_t>(dbg));
   }
 
   LiveIntervalsVISA readLiveIntervalsVISA() {
@@ -329,7 +335,7 @@ private:
           v.lrs.push_back(lv);
         }
 
-        f.Vars.push_back(v);
+        f.Vars.push_back(std::move(v));
       }
 
       // subroutines
@@ -347,7 +353,7 @@ private:
           LiveIntervalsVISA lv = readLiveIntervalsVISA();
           sub.retval.push_back(lv);
         }
-        f.subs.push_back(sub);
+        f.subs.push_back(std::move(sub));
       }
 
       // call frame information
@@ -384,7 +390,7 @@ private:
         phyRegSave.numEntries = read<uint16_t>(dbg);
         for (unsigned int k = 0; k != phyRegSave.numEntries; k++)
           phyRegSave.data.push_back(readRegInfoMapping());
-        f.cfi.calleeSaveEntry.push_back(phyRegSave);
+        f.cfi.calleeSaveEntry.push_back(std::move(phyRegSave));
       }
 
       f.cfi.numCallerSaveEntries = read<uint16_t>(dbg);
@@ -394,10 +400,10 @@ private:
         phyRegSave.numEntries = read<uint16_t>(dbg);
         for (unsigned int k = 0; k != phyRegSave.numEntries; k++)
           phyRegSave.data.push_back(readRegInfoMapping());
-        f.cfi.callerSaveEntry.push_back(phyRegSave);
+        f.cfi.callerSaveEntry.push_back(std::move(phyRegSave));
       }
 
-      compiledObjs.push_back(f);
+      compiledObjs.push_back(std::move(f));
     }
   }
 
@@ -411,4 +417,44 @@ public:
   void print(llvm::raw_ostream &OS) const;
   void dump() const;
 };
+
+// Fills a DbgDecoder from the structured records vISA hands over during
+// compilation (see VISAKernel::SetGenxDebugInfoSink), producing the same
+// result as decoding the binary debug info without serializing it first.
+class DbgDecoderBuilder final : public vISA::DebugInfoSink {
+  DbgDecoder Decoded{nullptr};
+
+  // Record the add* calls currently append to.
+  std::vector<DbgDecoder::LiveIntervalsVISA> *VISAIntervals = nullptr;
+  std::vector<DbgDecoder::LiveIntervalGenISA> *GenISAIntervals = nullptr;
+  DbgDecoder::PhyRegSaveInfoPerIP *RegSave = nullptr;
+
+  DbgDecoder::DbgInfoFormat &current() {
+    IGC_ASSERT(!Decoded.compiledObjs.empty());
+    return Decoded.compiledObjs.back();
+  }
+  void resetCursor() {
+    VISAIntervals = nullptr;
+    GenISAIntervals = nullptr;
+    RegSave = nullptr;
+  }
+
+public:
+  void beginCompiledObject(const char *name, uint32_t relocOffset) override;
+  void addCISAOffset(uint32_t cisaOffset, uint32_t genOffset) override;
+  void addCISAIndex(uint32_t cisaIndex, uint32_t genOffset) override;
+  void beginVariable(const char *name) override;
+  void beginSubroutine(const char *name, uint32_t startVISAIndex,
+                       uint32_t endVISAIndex) override;
+  void setFrameSize(uint16_t frameSize) override;
+  void beginFrameEntry(FrameEntry entry) override;
+  void addLiveInterval(const vISA::DebugInfoLiveInterval &lr) override;
+  void beginRegSave(bool isCalleeSave, uint32_t genIPOffset) override;
+  void
+  addRegSaveMapping(const vISA::DebugInfoRegSaveMapping &mapping) override;
+
+  bool empty() const { return Decoded.compiledObjs.empty(); }
+  // Hands over the collected data, the builder must not be used afterwards.
+  DbgDecoder take() { return std::move(Decoded); }
+};
 } // namespace IGC
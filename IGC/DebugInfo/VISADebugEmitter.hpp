@@ -39,6 +39,7 @@ class StreamEmitter;
 class VISAModule;
 class DwarfDebug;
 class DwarfDISubprogramCache;
+class DwarfTypePool;
 class CodeGenContext;
 class VISADebugInfo;
 
@@ -52,6 +53,7 @@ public:
                   const DebugEmitterOpts &Opts) override;
 
   void SetDISPCache(DwarfDISubprogramCache *DISPCache) override;
+  void SetTypePool(DwarfTypePool *TypePool) override;
 
   std::vector<char> Finalize(bool Finalize,
                              const IGC::VISADebugInfo &VisaDbgInfo) override;
@@ -106,13 +106,16 @@ void VISAObjectDebugInfo::print(llvm::raw_ostream &OS) const {
   OS << "}\n";
 }
 
-VISADebugInfo::VISADebugInfo(const void *RawDbgDataPtr)
-    : DecodedDebugStorage(RawDbgDataPtr) {
+VISADebugInfo::VISADebugInfo(IGC::DbgDecoder &&DecodedDebugStorageIn)
+    : DecodedDebugStorage(std::move(DecodedDebugStorageIn)) {
   for (const auto &CO : DecodedDebugStorage.compiledObjs) {
     DebugInfoMap.emplace(std::make_pair(&CO, VISAObjectDebugInfo(CO)));
   }
 }
 
+VISADebugInfo::VISADebugInfo(const void *RawDbgDataPtr)
+    : VISADebugInfo(IGC::DbgDecoder(RawDbgDataPtr)) {}
+
 const VISAObjectDebugInfo &
 VISADebugInfo::getVisaObjectDI(const VISAModule &VM) const {
 
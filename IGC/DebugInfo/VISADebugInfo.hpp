@@ -94,7 +94,7 @@ class VISADebugInfo {
   DebugInfoHolders DebugInfoMap;
 
 public:
-  // VISADebugInfo(const IGC::DbgDecoder &DecodedDebugStorageIn);
+  VISADebugInfo(IGC::DbgDecoder &&DecodedDebugStorageIn);
   VISADebugInfo(const void *RawDbgDataPtr);
 
   // get's the underlying IGC::DbgDecoder object
@@ -35,6 +35,7 @@ struct DebugEmitterOpts;
 class CShader;
 class VISAModule;
 class DwarfDISubprogramCache;
+class DwarfTypePool;
 class VISADebugInfo;
 
 /// @brief IDebugEmitter is an interface for debug info emitter class.
@@ -63,6 +64,13 @@ public:
   //  nodes. Calling this method is optional (this is an optimization).
   /// @param DISPCache [IN] pointer to an external DwarfDISubprogramCache
   virtual void SetDISPCache(DwarfDISubprogramCache *DISPCache) = 0;
+
+  /// @brief TypePool shares type DIEs and abbreviations between the kernels
+  //  of a program. Calling this method is optional; it must be called
+  //  before the first Finalize of the kernel.
+  /// @param TypePool [IN] pointer to an external DwarfTypePool
+  virtual void SetTypePool(DwarfTypePool *TypePool) = 0;
+
   /// @brief Emit debug info to given buffer and reset debug emitter.
   /// @param Finalize [IN] indicates whether this is last function in group.
   /// @param VisaDbgIngo [IN] holds decoded VISA debug information.
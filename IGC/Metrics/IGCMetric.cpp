@@ -71,6 +71,11 @@ namespace IGCMetrics
         get(igcMetric)->CollectRegStats(kernelInfo, pFunc);
     }
 
+    void IGCMetric::CollectThroughputEstimate(const vISA::PERF_STATS& vISAstats, llvm::Function* pFunc)
+    {
+        get(igcMetric)->CollectThroughputEstimate(vISAstats, pFunc);
+    }
+
     void IGCMetric::CollectFunctions(llvm::Module* pModule)
     {
         get(igcMetric)->CollectFunctions(pModule);
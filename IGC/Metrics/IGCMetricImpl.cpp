@@ -441,6 +441,38 @@ namespace IGCMetrics
 #endif
     }
 
+    void IGCMetricImpl::CollectThroughputEstimate(const vISA::PERF_STATS& vISAstats, llvm::Function* pFunc)
+    {
+        if (!Enable()) return;
+#ifdef IGC_METRICS__PROTOBUF_ATTACHED
+        auto func_m = GetFuncMetric(pFunc);
+        if (func_m == nullptr)
+        {
+            return;
+        }
+        auto throughput_m = func_m->mutable_costmodel_stats()->mutable_throughput();
+        throughput_m->set_cycles(vISAstats.estCycle);
+        throughput_m->set_alucycles(vISAstats.estALUCycle);
+        throughput_m->set_sendcycles(vISAstats.estSendCycle);
+        throughput_m->set_synccycles(vISAstats.estSyncCycle);
+        switch (vISAstats.estBottleneck)
+        {
+        case vISA::PERF_BOTTLENECK::ALU:
+            throughput_m->set_limiter(IGC_METRICS::CostModelStats_ThroughputEstimate_Bottleneck_ALU);
+            break;
+        case vISA::PERF_BOTTLENECK::SEND:
+            throughput_m->set_limiter(IGC_METRICS::CostModelStats_ThroughputEstimate_Bottleneck_SEND);
+            break;
+        case vISA::PERF_BOTTLENECK::SYNC:
+            throughput_m->set_limiter(IGC_METRICS::CostModelStats_ThroughputEstimate_Bottleneck_SYNC);
+            break;
+        default:
+            throughput_m->set_limiter(IGC_METRICS::CostModelStats_ThroughputEstimate_Bottleneck_NONE);
+            break;
+        }
+#endif
+    }
+
     void IGCMetricImpl::CollectFunctions(llvm::Module* pModule)
     {
         if (!Enable()) return;
@@ -17,6 +17,7 @@ SPDX-License-Identifier: MIT
 #include <3d/common/iStdLib/types.h>
 #include <common/shaderHash.hpp>
 #include "KernelInfo.h"
+#include "JitterDataStruct.h"
 #include "IGCMetric.h"
 
 #ifdef IGC_METRICS__PROTOBUF_ATTACHED
@@ -130,6 +131,7 @@ namespace IGCMetrics
         void StatIncCoalesced(llvm::Instruction* coalescedAccess);
 
         void CollectRegStats(KERNEL_INFO* vISAstats, llvm::Function* pFunc);
+        void CollectThroughputEstimate(const vISA::PERF_STATS& vISAstats, llvm::Function* pFunc);
 
         void UpdateVariable(llvm::Value* Org, llvm::Value* New);
         void CollectMem2Reg(llvm::AllocaInst* pAllocaInst, IGC::StatusPrivArr2Reg status);
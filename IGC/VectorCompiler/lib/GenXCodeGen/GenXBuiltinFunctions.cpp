@@ -13,6 +13,10 @@ SPDX-License-Identifier: MIT
 /// GenXMathFunction is a module pass that implements floating point math
 /// functions
 ///
+/// The implementations come from the built-in library that vcb pre-compiles
+/// for each platform. The library is decoded lazily and only the functions
+/// that end up being called are linked into the module.
+///
 //===----------------------------------------------------------------------===//
 
 #include "GenXSubtarget.h"
@@ -22,6 +26,7 @@ SPDX-License-Identifier: MIT
 #include "vc/Utils/GenX/KernelInfo.h"
 #include "vc/Utils/General/BiF.h"
 
+#include <llvm/ADT/SmallPtrSet.h>
 #include <llvm/CodeGen/TargetPassConfig.h>
 #include <llvm/IR/InstVisitor.h>
 #include <llvm/IR/Module.h>
@@ -72,6 +77,12 @@ private:
                            ArrayRef<Value *> Args);
 
   const GenXSubtarget *ST = nullptr;
+
+  // The built-in library, loaded lazily. Only the functions the module asks
+  // for are linked from it; their bodies are decoded on linking.
+  std::unique_ptr<Module> Lib;
+  // A declaration of a library function was added since the last linking.
+  bool NeedsLinking = false;
 };
 
 char GenXBuiltinFunctions::ID = 0;
@@ -104,13 +115,29 @@ bool GenXBuiltinFunctions::runOnModule(Module &M) {
             .getTM<GenXTargetMachine>()
             .getGenXSubtarget();
 
-  auto Lib =
-      loadBuiltinLib(M.getContext(), M.getDataLayout(), M.getTargetTriple());
-  if (Lib && Linker::linkModules(M, std::move(Lib)))
-    report_fatal_error("Error linking built-in functions");
-
-  for (auto &F : M.getFunctionList())
-    runOnFunction(F);
+  auto LoadLib = [&]() {
+    Lib =
+        loadBuiltinLib(M.getContext(), M.getDataLayout(), M.getTargetTriple());
+  };
+  LoadLib();
+
+  // The library is pre-compiled for the target (see vcb), so only the
+  // functions that are actually called are linked. The linked functions may
+  // need other library functions in turn, so repeat until nothing new is
+  // requested. Every function is visited once.
+  SmallPtrSet<const Function *, 16> Visited;
+  do {
+    if (NeedsLinking) {
+      NeedsLinking = false;
+      if (Linker::linkModules(M, std::move(Lib), Linker::Flags::LinkOnlyNeeded))
+        report_fatal_error("Error linking built-in functions");
+      LoadLib();
+    }
+    for (auto &F : M.getFunctionList())
+      if (!F.isDeclaration() && Visited.insert(&F).second)
+        runOnFunction(F);
+  } while (NeedsLinking);
+  Lib.reset();
 
   // Remove unused built-in functions, mark used as internal
   std::vector<Function *> ToErase;
@@ -363,6 +390,17 @@ Function *GenXBuiltinFunctions::getBuiltinDeclaration(Module &M, StringRef Name,
   FuncName += Suffix;
 
   auto *Func = M.getFunction(FuncName);
+  if (Func || !Lib)
+    return Func;
+
+  // Declare the library function; its body is linked later on
+  auto *LibFunc = Lib->getFunction(FuncName);
+  if (!LibFunc || LibFunc->isDeclaration())
+    return nullptr;
+  Func = Function::Create(LibFunc->getFunctionType(),
+                          GlobalValue::ExternalLinkage, FuncName, M);
+  Func->setAttributes(LibFunc->getAttributes());
+  NeedsLinking = true;
   return Func;
 }
 
@@ -376,7 +414,7 @@ GenXBuiltinFunctions::loadBuiltinLib(LLVMContext &Ctx, const DataLayout &DL,
   if (BiFBuffer.getBufferSize() == 0)
     return nullptr;
 
-  auto BiFModule = vc::getBiFModuleOrReportError(BiFBuffer, Ctx);
+  auto BiFModule = vc::getLazyBiFModuleOrReportError(BiFBuffer, Ctx);
 
   BiFModule->setDataLayout(DL);
   BiFModule->setTargetTriple(Triple);
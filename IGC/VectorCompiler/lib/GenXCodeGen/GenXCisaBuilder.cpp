@@ -6270,6 +6270,11 @@ public:
     VISABuilder *CisaBuilder = GM.GetCisaBuilder();
     if (GM.HasInlineAsm() || !BC->getVISALTOStrings().empty())
       CisaBuilder = GM.GetVISAAsmReader();
+    else
+      for (auto *FG : FGA)
+        if (vc::isKernel(FG->getHead()))
+          GM.addDebugInfoSink(
+              *CisaBuilder->GetVISAKernel(FG->getName().str()));
     CISA_CALL(CisaBuilder->Compile(
         BC->isaDumpsEnabled() && BC->hasShaderDumper()
             ? BC->getShaderDumper().composeDumpPath("final.isa").c_str()
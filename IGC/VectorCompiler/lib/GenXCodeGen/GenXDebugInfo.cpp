@@ -315,6 +315,8 @@ struct ProgramInfo {
   const ModuleToVisaTransformInfo &MVTI;
   VISAKernel &CompiledKernel;
   std::vector<FunctionInfo> FIs;
+  // Set if vISA handed the debug info over to a sink instead of a binary.
+  IGC::DbgDecoderBuilder *DebugInfoSink = nullptr;
 
   const Function &getEntryPoint() const {
     IGC_ASSERT(!FIs.empty());
@@ -659,8 +661,8 @@ class GenObjectWrapper {
 public:
   const Function &getEntryPoint() const { return EntryPoint; }
 
+  // Empty if the debug info was collected through a sink.
   ArrayRef<char> getGenDebug() const {
-    IGC_ASSERT(GenDbgInfoDataPtr);
     return ArrayRef<char>(static_cast<char *>(GenDbgInfoDataPtr),
                           GenDbgInfoDataSize);
   }
@@ -681,7 +683,8 @@ public:
     return *JitInfo;
   };
 
-  GenObjectWrapper(VISAKernel &VK, const Function &F);
+  GenObjectWrapper(VISAKernel &VK, const Function &F,
+                   IGC::DbgDecoderBuilder *Sink = nullptr);
   ~GenObjectWrapper() { releaseDebugInfoResources(); }
 
   bool hasErrors() const { return !ErrMsg.empty(); }
@@ -705,7 +708,8 @@ public:
   }
 };
 
-GenObjectWrapper::GenObjectWrapper(VISAKernel &VK, const Function &F)
+GenObjectWrapper::GenObjectWrapper(VISAKernel &VK, const Function &F,
+                                   IGC::DbgDecoderBuilder *Sink)
     : EntryPoint(F) {
   if (VK.GetJitInfo(JitInfo) != 0) {
     setError("could not extract jitter info");
@@ -720,6 +724,15 @@ GenObjectWrapper::GenObjectWrapper(VISAKernel &VK, const Function &F)
     return;
   }
 
+  if (Sink) {
+    if (Sink->empty()) {
+      setError("debug info sink was not filled by finalizer");
+      return;
+    }
+    VISADebugInfo = std::make_unique<IGC::VISADebugInfo>(Sink->take());
+    return;
+  }
+
   if (VK.GetGenxDebugInfo(GenDbgInfoDataPtr, GenDbgInfoDataSize) != 0) {
     setError("could not get gen debug information from finalizer");
     return;
@@ -1410,8 +1423,9 @@ void dumpDebugInfo(const GenXBackendConfig &BC, const GenObjectWrapper &GOW,
   std::string Prefix = makePrefixForAuxiliaryShaderDump(BC, GOW);
 
   vc::produceAuxiliaryShaderDumpFile(BC, Twine(Prefix) + "_dwarf.elf", ElfBin);
-  vc::produceAuxiliaryShaderDumpFile(BC, Twine(Prefix) + "_gen.dump",
-                                     GOW.getGenDebug());
+  if (!GOW.getGenDebug().empty())
+    vc::produceAuxiliaryShaderDumpFile(BC, Twine(Prefix) + "_gen.dump",
+                                       GOW.getGenDebug());
   vc::produceAuxiliaryShaderDumpFile(BC, Twine(Prefix) + "_gen.decoded.dump",
                                      DecodedGenInfo);
   vc::produceAuxiliaryShaderDumpFile(BC, Twine(Prefix) + "_visa.mapping",
@@ -1432,7 +1446,8 @@ void GenXDebugInfo::processKernel(const IGC::DebugEmitterOpts &DebugOpts,
                              .count(&PI.getEntryPoint()) == 1,
                      "The head of ProgramInfo is expected to be a kernel");
 
-  GenObjectWrapper GOW(PI.CompiledKernel, PI.getEntryPoint());
+  GenObjectWrapper GOW(PI.CompiledKernel, PI.getEntryPoint(),
+                       PI.DebugInfoSink);
   if (GOW.hasErrors())
     vc::diagnose(GOW.getEntryPoint().getContext(), "GenXDebugInfo",
                  GOW.getError());
@@ -1540,7 +1555,8 @@ void GenXDebugInfo::processPrimaryFunction(
                    const auto &Mapping = *GM.getVisaMapping(F);
                    return FunctionInfo{Mapping, *F};
                  });
-  processKernel(Opts, ProgramInfo{MVTI, *VKEntry, std::move(FIs)});
+  processKernel(Opts, ProgramInfo{MVTI, *VKEntry, std::move(FIs),
+                                  GM.getDebugInfoSink(VKEntry)});
 }
 
 static void fillDbgInfoOptions(const GenXBackendConfig &BC,
@@ -33,6 +33,7 @@ SPDX-License-Identifier: MIT
 #include "llvmWrapper/IR/InstrTypes.h"
 #include "llvmWrapper/IR/Instructions.h"
 
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/CodeGen/TargetPassConfig.h"
 #include "llvm/IR/BasicBlock.h"
@@ -76,14 +77,14 @@ bool GenXLiveness::runOnFunctionGroup(FunctionGroup &ArgFG)
  */
 void GenXLiveness::releaseMemory() {
   LLVM_DEBUG(dbgs() << "releaseMemory for GenXLivness\n");
-  while (!LiveRangeMap.empty()) {
-    LiveRange *LR = begin()->second;
-    for (auto i = LR->value_begin(), e = LR->value_end(); i != e; ++i) {
-      SimpleValue V = *i;
-      LiveRangeMap.erase(V);
-    }
+  // Several values may share a live range, so collect the distinct ones
+  // first.
+  SmallPtrSet<LiveRange *, 16> LRs;
+  for (auto &Entry : LiveRangeMap)
+    LRs.insert(Entry.second);
+  LiveRangeMap.clear();
+  for (LiveRange *LR : LRs)
     delete LR;
-  }
   FG = 0;
   CG.reset();
   for (auto i = UnifiedRets.begin(), e = UnifiedRets.end(); i != e; ++i)
@@ -620,7 +621,7 @@ void GenXLiveness::replaceValue(SimpleValue OldVal, SimpleValue NewVal)
  */
 LiveRange *GenXLiveness::getOrCreateLiveRange(SimpleValue V)
 {
-  auto [i, isInserted] = LiveRangeMap.emplace(V, nullptr);
+  auto [i, isInserted] = LiveRangeMap.try_emplace(V, nullptr);
   LLVM_DEBUG(dbgs() << "getOrCreateLiveRange for SimpleValue: " << V << " "
                     << (isInserted ? "Inserted" : "Not inserted") << "\n");
   LiveRange *LR = i->second;
@@ -165,6 +165,7 @@ SPDX-License-Identifier: MIT
 #include "Probe/Assertion.h"
 #include "vc/Utils/General/IndexFlattener.h"
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/IR/DerivedTypes.h"
@@ -456,9 +457,30 @@ public:
 
 } // end namespace genx
 
+// Specialize DenseMapInfo for SimpleValue.
+template <> struct DenseMapInfo<genx::SimpleValue> {
+  static inline genx::SimpleValue getEmptyKey() {
+    return genx::SimpleValue(DenseMapInfo<Value *>::getEmptyKey());
+  }
+  static inline genx::SimpleValue getTombstoneKey() {
+    return genx::SimpleValue(DenseMapInfo<Value *>::getTombstoneKey());
+  }
+  static unsigned getHashValue(const genx::SimpleValue &SV) {
+    return DenseMapInfo<Value *>::getHashValue(SV.getValue()) ^
+           DenseMapInfo<unsigned>::getHashValue(SV.getIndex());
+  }
+  static bool isEqual(const genx::SimpleValue &LHS,
+                      const genx::SimpleValue &RHS) {
+    return LHS == RHS;
+  }
+};
+
 class GenXLiveness : public FGPassImplInterface, public IDMixin<GenXLiveness> {
   FunctionGroup *FG = nullptr;
-  using LiveRangeMap_t = std::map<genx::SimpleValue, genx::LiveRange *>;
+  // A flat hash map: liveness is queried for every value during coalescing
+  // and register allocation, which for large kernels made the lookups in a
+  // tree keyed by SimpleValue show up in the profile.
+  using LiveRangeMap_t = DenseMap<genx::SimpleValue, genx::LiveRange *>;
   LiveRangeMap_t LiveRangeMap;
   std::unique_ptr<genx::CallGraph> CG;
   GenXBaling *Baling = nullptr;
@@ -487,8 +509,8 @@ public:
     CoalescingDisabled = NoCoalescingMode;
   }
   // Iterator forwarders.
-  // This gives you an iterator of LiveRangeMap. The ->first field is the
-  // value, and you only get each value once. The ->second field is the
+  // This gives you an iterator of LiveRangeMap, in no particular order. The
+  // ->first field is the value, and you only get each value once. The ->second field is the
   // LiveRange pointer, and you may get each one multiple times because
   // a live range may contain multiple values.
   typedef LiveRangeMap_t::iterator iterator;
@@ -607,24 +629,6 @@ using GenXLivenessWrapper = FunctionGroupWrapperPass<GenXLiveness>;
 
 void initializeGenXLivenessWrapperPass(PassRegistry &);
 
-// Specialize DenseMapInfo for SimpleValue.
-template <> struct DenseMapInfo<genx::SimpleValue> {
-  static inline genx::SimpleValue getEmptyKey() {
-    return genx::SimpleValue(DenseMapInfo<Value *>::getEmptyKey());
-  }
-  static inline genx::SimpleValue getTombstoneKey() {
-    return genx::SimpleValue(DenseMapInfo<Value *>::getTombstoneKey());
-  }
-  static unsigned getHashValue(const genx::SimpleValue &SV) {
-    return DenseMapInfo<Value *>::getHashValue(SV.getValue()) ^
-           DenseMapInfo<unsigned>::getHashValue(SV.getIndex());
-  }
-  static bool isEqual(const genx::SimpleValue &LHS,
-                      const genx::SimpleValue &RHS) {
-    return LHS == RHS;
-  }
-};
-
 } // end namespace llvm
 namespace std {
 template <> struct hash<llvm::genx::Segment> {
@@ -22,10 +22,13 @@ SPDX-License-Identifier: MIT
 #include "vc/Utils/GenX/KernelInfo.h"
 #include "vc/Utils/General/DebugInfo.h"
 
+#include "visa/include/visaBuilder_interface.h"
+
 #include <llvm/CodeGen/TargetPassConfig.h>
 #include <llvm/GenXIntrinsics/GenXMetadata.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Instructions.h>
+#include <llvm/Support/CommandLine.h>
 #include <llvm/Support/Debug.h>
 #include <llvm/Transforms/Utils/Cloning.h>
 
@@ -36,6 +39,11 @@ SPDX-License-Identifier: MIT
 
 using namespace llvm;
 
+static cl::opt<bool> DbgInfoUseSink(
+    "vc-dbginfo-use-sink", cl::init(false), cl::Hidden,
+    cl::desc("Collect the Gen debug info through a vISA debug info sink "
+             "instead of decoding the binary emitted by the finalizer"));
+
 char GenXModule::ID = 0;
 INITIALIZE_PASS_BEGIN(GenXModule, "GenXModule", "GenXModule", false,
                       true /*analysis*/)
@@ -203,6 +211,21 @@ GenXModule::getVisaMapping(const Function *F) const {
   return &VisaMapping.at(F);
 }
 
+void GenXModule::addDebugInfoSink(VISAKernel &K) {
+  if (!EmitDebugInformation || !DbgInfoUseSink)
+    return;
+  auto &Sink = DebugInfoSinks[&K];
+  IGC_ASSERT_MESSAGE(!Sink, "debug info sink is already installed");
+  Sink = std::make_unique<IGC::DbgDecoderBuilder>();
+  K.SetGenxDebugInfoSink(Sink.get());
+}
+
+IGC::DbgDecoderBuilder *
+GenXModule::getDebugInfoSink(const VISAKernel *K) const {
+  auto It = DebugInfoSinks.find(K);
+  return It == DebugInfoSinks.end() ? nullptr : It->second.get();
+}
+
 GenXModule::InfoForFinalizer GenXModule::getInfoForFinalizer() const {
   InfoForFinalizer Info;
   Info.EmitDebugInformation = EmitDebugInformation;
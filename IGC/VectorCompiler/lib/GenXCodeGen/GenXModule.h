@@ -46,6 +46,8 @@ SPDX-License-Identifier: MIT
 
 #include "vc/Support/BackendConfig.h"
 
+#include "DebugInfo/VISADebugDecoder.hpp"
+
 #include "llvm/ADT/Twine.h"
 #include "llvm/Pass.h"
 #include "llvm/PassRegistry.h"
@@ -53,7 +55,9 @@ SPDX-License-Identifier: MIT
 #include <inc/common/sku_wa.h>
 
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Probe/Assertion.h"
@@ -92,10 +96,15 @@ namespace llvm {
     std::unordered_map<const Function *, unsigned> VisaCounter;
     // stores vISA mappings for each *function* (including kernel subroutines)
     std::unordered_map<const Function *, genx::di::VisaMapping> VisaMapping;
+    // debug info sinks installed on the *kernels*, see addDebugInfoSink
+    std::unordered_map<const VISAKernel *,
+                       std::unique_ptr<IGC::DbgDecoderBuilder>>
+        DebugInfoSinks;
 
   private:
     void cleanup() {
       VisaMapping.clear();
+      DebugInfoSinks.clear();
       VisaCounter.clear();
       DestroyCISABuilder();
       DestroyVISAAsmReader();
@@ -134,6 +143,13 @@ namespace llvm {
     void updateVisaCountMapping(const Function *F, const Instruction *Inst,
                                 unsigned VisaIndex, StringRef Reason);
     const genx::di::VisaMapping *getVisaMapping(const Function *F) const;
+    // Makes vISA hand the debug info of kernel K over to a sink instead of
+    // encoding it into a binary buffer. Does nothing unless debug info is
+    // emitted and -vc-dbginfo-use-sink is set. Must be called before K is
+    // compiled.
+    void addDebugInfoSink(VISAKernel &K);
+    // Returns the sink installed on K or nullptr if there is none.
+    IGC::DbgDecoderBuilder *getDebugInfoSink(const VISAKernel *K) const;
     // Returns additional info requred to create VISABuilder.
     // Subtarget must be already initialized before calling this method.
     InfoForFinalizer getInfoForFinalizer() const;
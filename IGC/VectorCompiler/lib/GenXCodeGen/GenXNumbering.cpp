@@ -53,6 +53,13 @@ bool GenXNumbering::runOnFunctionGroup(FunctionGroup &ArgFG)
 {
   FG = &ArgFG;
   Baling = &getAnalysis<GenXGroupBaling>();
+  unsigned NumBlocks = 0, NumValues = 0;
+  for (auto fgi = FG->begin(), fge = FG->end(); fgi != fge; ++fgi) {
+    NumBlocks += (*fgi)->size();
+    NumValues += 1 + (*fgi)->size() + (*fgi)->getInstructionCount();
+  }
+  BBNumbers = std::make_unique<BBNumberMap_t>(NumBlocks);
+  Numbers = std::make_unique<NumberMap_t>(NumValues);
   unsigned Num = 0;
   for (auto fgi = FG->begin(), fge = FG->end(); fgi != fge; ++fgi)
     Num = numberInstructionsInFunc(*fgi, Num);
@@ -64,8 +71,8 @@ bool GenXNumbering::runOnFunctionGroup(FunctionGroup &ArgFG)
  * releaseMemory : clear the GenXNumbering
  */
 void GenXNumbering::releaseMemory() {
-  BBNumbers.clear();
-  Numbers.clear();
+  BBNumbers->clear();
+  Numbers->clear();
   NumberToPhiIncomingMap.clear();
 }
 
@@ -75,13 +82,13 @@ void GenXNumbering::releaseMemory() {
 unsigned GenXNumbering::numberInstructionsInFunc(Function *Func, unsigned Num)
 {
   // Number the function, reserving one number for the args.
-  Numbers[Func] = Num++;
+  (*Numbers)[Func] = Num++;
   for (Function::iterator fi = Func->begin(), fe = Func->end(); fi != fe; ++fi) {
     BasicBlock *Block = &*fi;
     // Number the basic block.
-    auto BBNumber = &BBNumbers[Block];
-    BBNumber->Index = BBNumbers.size() - 1;
-    Numbers[Block] = Num++;
+    auto BBNumber = &(*BBNumbers)[Block];
+    BBNumber->Index = BBNumbers->size() - 1;
+    (*Numbers)[Block] = Num++;
     // If this is the first block of a kernel, reserve kernel arg copy slots.
     if (Block == &Func->front() && vc::isKernel(Func))
       for (auto ai = Func->arg_begin(), ae = Func->arg_end(); ai != ae; ++ai)
@@ -132,7 +139,7 @@ unsigned GenXNumbering::numberInstructionsInFunc(Function *Func, unsigned Num)
       }
       // Number the instruction, reserving PreReserve.
       Num += PreReserve;
-      Numbers[Inst] = Num;
+      (*Numbers)[Inst] = Num;
       Num += 1 + PostReserve;
     }
     // We have reached the terminator instruction but not yet numbered it.
@@ -164,7 +171,7 @@ unsigned GenXNumbering::numberInstructionsInFunc(Function *Func, unsigned Num)
       PreReserve = IndexFlattener::getNumElements(Func->getReturnType());
     }
     Num += PreReserve;
-    Numbers[Inst] = Num++;
+    (*Numbers)[Inst] = Num++;
     BBNumber->EndNumber = Num;
   }
   return Num;
@@ -183,7 +190,7 @@ unsigned GenXNumbering::getBaleNumber(Instruction *Inst)
  * getNumber : get instruction number, or 0 if none
  */
 unsigned GenXNumbering::getNumber(Value *V) const {
-  auto i = Numbers.find(V), e = Numbers.end();
+  auto i = Numbers->find(V), e = Numbers->end();
   if (i == e)
     return 0;
   return i->second;
@@ -194,7 +201,7 @@ unsigned GenXNumbering::getNumber(Value *V) const {
  */
 void GenXNumbering::setNumber(Value *V, unsigned Number)
 {
-  Numbers[V] = Number;
+  (*Numbers)[V] = Number;
 }
 
 /***********************************************************************
@@ -223,7 +230,7 @@ unsigned GenXNumbering::getArgIndirectionNumber(CallInst *CI, unsigned OperandNu
 unsigned GenXNumbering::getKernelArgCopyNumber(Argument *Arg)
 {
   IGC_ASSERT(vc::isKernel(Arg->getParent()));
-  return Numbers[&Arg->getParent()->front()] + 1 + Arg->getArgNo();
+  return (*Numbers)[&Arg->getParent()->front()] + 1 + Arg->getArgNo();
 }
 
 /***********************************************************************
@@ -283,7 +290,7 @@ unsigned GenXNumbering::getPhiNumber(PHINode *Phi, BasicBlock *BB) const
 {
   // The instruction number is the count of phi nodes before it added to the
   // PhiNumber for the predecessor.
-  return BBNumbers.find(BB)->second.PhiNumber + getPhiOffset(Phi);
+  return BBNumbers->find(BB)->second.PhiNumber + getPhiOffset(Phi);
 }
 
 unsigned GenXNumbering::getPhiNumber(PHINode *Phi, BasicBlock *BB)
@@ -342,13 +349,14 @@ void GenXNumbering::print(raw_ostream &OS) const
       OS << Func->getName() << ":\n";
     for (Function::iterator fi = Func->begin(), fe = Func->end(); fi != fe; ++fi) {
       BasicBlock *BB = &*fi;
-      OS << "\n" << Numbers.find(BB)->second << " " << BB->getName() << ":\n";
+      OS << "\n" << Numbers->find(BB)->second << " " << BB->getName() << ":\n";
       for (BasicBlock::iterator bi = BB->begin(), be = BB->end(); bi != be; ++bi) {
         Instruction *Inst = &*bi;
-        if (Numbers.find(Inst) == Numbers.end())
+        auto NI = Numbers->find(Inst);
+        if (NI == Numbers->end())
           OS << " - ";
         else
-          OS << Numbers.find(Inst)->second;
+          OS << NI->second;
         OS << "   ";
         Inst->print(OS);
         OS << "\n";
@@ -58,6 +58,7 @@ SPDX-License-Identifier: MIT
 #include "IgnoreRAUWValueMap.h"
 #include "llvm/IR/Value.h"
 
+#include <memory>
 #include <unordered_map>
 
 namespace llvm {
@@ -76,12 +77,18 @@ class GenXNumbering : public FGPassImplInterface,
     unsigned PhiNumber; // instruction number of first phi node in successor
     unsigned EndNumber; // instruction number of end of block
   };
+  using BBNumberMap_t =
+      ValueMap<const BasicBlock *, BBNumber,
+               IgnoreRAUWValueMapConfig<const BasicBlock *>>;
+  using NumberMap_t =
+      ValueMap<const Value *, unsigned, IgnoreRAUWValueMapConfig<const Value *>>;
   // BBNumbers : The 0-based number (index) of each basic block.
-  ValueMap<const BasicBlock *, BBNumber,
-          IgnoreRAUWValueMapConfig<const BasicBlock *>> BBNumbers;
   // Numbers : The map of instruction numbers.
-  ValueMap<const Value *, unsigned,
-          IgnoreRAUWValueMapConfig<const Value *>> Numbers;
+  // Both are recreated by runOnFunctionGroup with room for every block and
+  // instruction of the group (a ValueMap can't be resized in place, and
+  // growing one moves all its value handles).
+  std::unique_ptr<BBNumberMap_t> BBNumbers = std::make_unique<BBNumberMap_t>();
+  std::unique_ptr<NumberMap_t> Numbers = std::make_unique<NumberMap_t>();
   // StartNumbers : for a CallInst, the start number of where arg pre-copies
   // are considered to be. This is stored, instead of being calculated from
   // the CallInst's number, so that a CallInst can change number of args, as
@@ -105,7 +112,7 @@ public:
   static void getAnalysisUsage(AnalysisUsage &AU);
   bool runOnFunctionGroup(FunctionGroup &FG) override;
   // get BBNumber struct for a basic block
-  const BBNumber *getBBNumber(BasicBlock *BB) { return &BBNumbers[BB]; }
+  const BBNumber *getBBNumber(BasicBlock *BB) { return &(*BBNumbers)[BB]; }
   // get and set instruction number
   unsigned getBaleNumber(Instruction *Inst);
   unsigned getNumber(Value *V) const;
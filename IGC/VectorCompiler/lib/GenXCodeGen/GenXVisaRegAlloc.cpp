@@ -190,6 +190,13 @@ bool GenXVisaRegAlloc::runOnFunctionGroup(FunctionGroup &FGArg)
   if (BackendConfig->localizeLiveRangesForAccUsage())
     localizeLiveRangesForAccUsage(LRs);
 
+  // Size the register map up front; rehashing it a few times over is
+  // measurable on large kernels.
+  unsigned NumValues = 0;
+  for (auto *LR : LRs)
+    NumValues += LR->value_size();
+  RegMap.reserve(NumValues);
+
   // Allocate a register to each live range.
   for (auto i = LRs.begin(), e = LRs.end(); i != e; ++i)
     allocReg(*i);
@@ -139,7 +139,7 @@ namespace llvm {
     };
 
     using RegPushHook = void(*)(void* Object, Reg&);
-    using RegMap_t = std::map<genx::SimpleValue, Reg *>;
+    using RegMap_t = DenseMap<genx::SimpleValue, Reg *>;
     using LRPtrVect = std::vector<genx::LiveRange *>;
     using LRCPtrVect = std::vector<const genx::LiveRange *>;
     void print(raw_ostream &OS, const FunctionGroup *FG) const override;
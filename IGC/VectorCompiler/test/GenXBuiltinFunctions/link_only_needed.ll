@@ -0,0 +1,30 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2024 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+
+; RUN: opt %use_old_pass_manager% -vc-builtins-bif-path=%VC_BUILTINS_BIF_XeLPG% \
+; RUN: -GenXBuiltinFunctions -march=genx64 -mtriple=spir64-unknown-unknown \
+; RUN: -mcpu=XeLPG -S < %s | FileCheck %s
+
+; COM: Only the library functions that are called get linked in.
+; CHECK-NOT: define {{.*}} @__vc_builtin_sdiv_i64(
+; CHECK-NOT: define {{.*}} @__vc_builtin_urem_i64(
+
+; CHECK: define dllexport spir_kernel void @test_kernel
+; CHECK-NEXT: %udiv = call i64 @__vc_builtin_udiv_i64(i64 %l, i64 %r)
+; CHECK-NEXT: ret void
+
+; CHECK-NOT: define {{.*}} @__vc_builtin_sdiv_i64(
+; CHECK-NOT: define {{.*}} @__vc_builtin_urem_i64(
+; CHECK: define internal i64 @__vc_builtin_udiv_i64(
+; CHECK-NOT: define {{.*}} @__vc_builtin_sdiv_i64(
+; CHECK-NOT: define {{.*}} @__vc_builtin_urem_i64(
+
+define dllexport spir_kernel void @test_kernel(i64 %l, i64 %r) {
+  %udiv = udiv i64 %l, %r
+  ret void
+}
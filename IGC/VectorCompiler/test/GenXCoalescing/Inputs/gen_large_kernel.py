@@ -0,0 +1,77 @@
+#=========================== begin_copyright_notice ============================
+#
+# Copyright (C) 2024 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+#============================ end_copyright_notice =============================
+
+# Generates a CM kernel with a long straight-line chain of vector operations
+# and many simultaneously live values, to time the liveness, coalescing and
+# register allocation passes on a large function:
+#
+#   python gen_large_kernel.py <number of operations> > big.ll
+#   llc big.ll -march=genx64 -mcpu=Gen9 -time-passes -o /dev/null
+
+import random
+import sys
+
+NUM_OPS = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+# values kept live at any point
+WINDOW = 24
+# operations per basic block
+BLOCK = 64
+VEC = '<8 x i32>'
+
+rnd = random.Random(1)
+out = []
+emit = out.append
+
+emit('target datalayout = "e-p:64:64-i64:64-n8:16:32"')
+emit('target triple = "genx64-unknown-unknown"')
+emit('')
+emit('declare %s @llvm.genx.oword.ld.v8i32(i32, i32, i32) #1' % VEC)
+emit('declare void @llvm.genx.oword.st.v8i32(i32, i32, %s) #2' % VEC)
+emit('')
+emit('define dllexport spir_kernel void @large_kernel(i32 %in, i32 %out) '
+     'local_unnamed_addr #0 {')
+emit('entry:')
+
+live = []
+for i in range(WINDOW):
+    emit('  %%ld%d = tail call %s @llvm.genx.oword.ld.v8i32(i32 0, i32 %%in, '
+         'i32 %d)' % (i, VEC, 2 * i))
+    live.append('%%ld%d' % i)
+
+ops = ['add', 'sub', 'mul', 'xor', 'and', 'or']
+for i in range(NUM_OPS):
+    if i and i % BLOCK == 0:
+        emit('  br label %%bb%d' % i)
+        emit('bb%d:' % i)
+    a, b = rnd.sample(live, 2)
+    op = rnd.choice(ops)
+    emit('  %%v%d = %s %s %s, %s' % (i, op, VEC, a, b))
+    live[rnd.randrange(WINDOW)] = '%%v%d' % i
+
+for i, v in enumerate(live):
+    emit('  tail call void @llvm.genx.oword.st.v8i32(i32 %%out, i32 %d, '
+         '%s %s)' % (2 * i, VEC, v))
+emit('  ret void')
+emit('}')
+emit('')
+emit('attributes #0 = { noinline nounwind "CMGenxMain" }')
+emit('attributes #1 = { nounwind readonly }')
+emit('attributes #2 = { nounwind }')
+emit('')
+emit('!genx.kernels = !{!0}')
+emit('!genx.kernel.internal = !{!4}')
+emit('')
+emit('!0 = !{void (i32, i32)* @large_kernel, !"large_kernel", !1, i32 0, '
+     '!2, !5, !3, i32 0}')
+emit('!1 = !{i32 2, i32 2}')
+emit('!2 = !{i32 64, i32 68}')
+emit('!3 = !{!"buffer_t", !"buffer_t"}')
+emit('!4 = !{void (i32, i32)* @large_kernel, null, null, null, null}')
+emit('!5 = !{i32 0, i32 0}')
+
+print('\n'.join(out))
@@ -0,0 +1,20 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2024 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+
+; COM: Compiles a generated kernel with thousands of simultaneously numbered
+; COM: values through liveness, coalescing and register allocation. Run the
+; COM: generator with a larger size and -time-passes to benchmark these
+; COM: passes (see Inputs/gen_large_kernel.py).
+
+; RUN: %python %S/Inputs/gen_large_kernel.py 4000 > %t.ll
+; RUN: llc %t.ll -march=genx64 -mcpu=Gen9 -time-passes -o /dev/null 2>&1 \
+; RUN: | FileCheck %s
+
+; CHECK-DAG: GenX live ranges analysis
+; CHECK-DAG: GenX coalescing and copy insertion
+; CHECK-DAG: GenX vISA virtual register allocator Wrapper
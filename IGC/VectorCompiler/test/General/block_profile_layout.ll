@@ -0,0 +1,66 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2024 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+
+; COM: The block labelled BB_2 sits between the entry block and its join block
+; COM: in the layout. With a -blockProfile entry marking it as never executed,
+; COM: the finalizer moves it to the end of the kernel: the entry branch is
+; COM: inverted to jump to it and it jumps back to the join block. SWSB runs
+; COM: on the new layout and still synchronizes the load in the moved block
+; COM: with its use.
+
+; RUN: echo "* BB_2 0" > %t.prof
+; RUN: llc %s -march=genx64 -mcpu=XeLP \
+; RUN: -finalizer-opts="-asmToConsole -blockProfile %t.prof" \
+; RUN: -o /dev/null | FileCheck %s --check-prefix=PROFILE
+; RUN: llc %s -march=genx64 -mcpu=XeLP -finalizer-opts='-asmToConsole' \
+; RUN: -o /dev/null | FileCheck %s --check-prefix=NOPROFILE
+
+; PROFILE: jmpi{{.*}} BB_2
+; PROFILE: BB_1:
+; PROFILE: BB_2:
+; PROFILE: send{{.*}}$[[TOKEN:[0-9]+]]}
+; PROFILE: $[[TOKEN]].dst
+; PROFILE: jmpi{{.*}} BB_1
+
+; NOPROFILE: jmpi{{.*}} BB_1
+; NOPROFILE: BB_2:
+; NOPROFILE: BB_1:
+; NOPROFILE-NOT: jmpi
+
+target triple = "genx64-unknown-unknown"
+
+declare <8 x i32> @llvm.genx.oword.ld.v8i32(i32, i32, i32)
+declare void @llvm.genx.oword.st.v8i32(i32, i32, <8 x i32>)
+
+define dllexport spir_kernel void @test_kernel(i32 %buf, <8 x i32> %a, i32 %n) local_unnamed_addr #0 {
+entry:
+  %cmp = icmp eq i32 %n, 0
+  br i1 %cmp, label %join, label %cold
+
+cold:
+  %ld = tail call <8 x i32> @llvm.genx.oword.ld.v8i32(i32 0, i32 %buf, i32 1)
+  %inc = add <8 x i32> %a, %ld
+  tail call void @llvm.genx.oword.st.v8i32(i32 %buf, i32 0, <8 x i32> %inc)
+  br label %join
+
+join:
+  tail call void @llvm.genx.oword.st.v8i32(i32 %buf, i32 2, <8 x i32> %a)
+  ret void
+}
+
+attributes #0 = { noinline nounwind "CMGenxMain" }
+
+!genx.kernels = !{!0}
+!genx.kernel.internal = !{!5}
+
+!0 = !{void (i32, <8 x i32>, i32)* @test_kernel, !"test_kernel", !1, i32 0, !2, !3, !4, i32 0}
+!1 = !{i32 2, i32 0, i32 0}
+!2 = !{i32 64, i32 96, i32 128}
+!3 = !{i32 0, i32 0, i32 0}
+!4 = !{!"buffer_t", !"", !""}
+!5 = !{void (i32, <8 x i32>, i32)* @test_kernel, null, null, null, null}
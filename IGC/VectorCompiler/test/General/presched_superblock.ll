@@ -0,0 +1,55 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2024 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+
+; COM: -presched-superblock moves the long-latency sqrt at the top of the
+; COM: fall-through block above the side exit of the entry block, where its
+; COM: result is dead. The dump bit of -presched-ctrl (1) reports each move.
+
+; RUN: llc %s -march=genx64 -mcpu=XeLP \
+; RUN: -finalizer-opts='-presched-force -presched-ctrl 5 -presched-superblock' \
+; RUN: -o /dev/null 2>&1 | FileCheck %s --check-prefix=HOIST
+; RUN: llc %s -march=genx64 -mcpu=XeLP \
+; RUN: -finalizer-opts='-presched-force -presched-ctrl 5' \
+; RUN: -o /dev/null 2>&1 | FileCheck %s --check-prefix=NOHOIST
+
+; HOIST: Hoist from BB{{[0-9]+}} to BB{{[0-9]+}}:
+; HOIST-SAME: math.sqrt
+; HOIST-NOT: Hoist from
+
+; NOHOIST-NOT: Hoist from
+
+target triple = "genx64-unknown-unknown"
+
+declare <8 x float> @llvm.genx.sqrt.v8f32(<8 x float>)
+declare void @llvm.genx.oword.st.v8f32(i32, i32, <8 x float>)
+
+define dllexport spir_kernel void @test_kernel(i32 %buf, <8 x float> %a, i32 %n) local_unnamed_addr #0 {
+entry:
+  %cmp = icmp eq i32 %n, 0
+  br i1 %cmp, label %exit, label %body
+
+body:
+  %sqrt = tail call <8 x float> @llvm.genx.sqrt.v8f32(<8 x float> %a)
+  tail call void @llvm.genx.oword.st.v8f32(i32 %buf, i32 0, <8 x float> %sqrt)
+  br label %exit
+
+exit:
+  ret void
+}
+
+attributes #0 = { noinline nounwind "CMGenxMain" }
+
+!genx.kernels = !{!0}
+!genx.kernel.internal = !{!5}
+
+!0 = !{void (i32, <8 x float>, i32)* @test_kernel, !"test_kernel", !1, i32 0, !2, !3, !4, i32 0}
+!1 = !{i32 2, i32 0, i32 0}
+!2 = !{i32 64, i32 96, i32 128}
+!3 = !{i32 0, i32 0, i32 0}
+!4 = !{!"buffer_t", !"", !""}
+!5 = !{void (i32, <8 x float>, i32)* @test_kernel, null, null, null, null}
@@ -0,0 +1,91 @@
+;=========================== begin_copyright_notice ============================
+;
+; Copyright (C) 2024 Intel Corporation
+;
+; SPDX-License-Identifier: MIT
+;
+;============================ end_copyright_notice =============================
+
+; COM: Compiling the stack-call functions on worker threads with
+; COM: -parallelFuncCompile must give the same code as compiling them in
+; COM: order. The options lines of the asm differ and are left out.
+
+; RUN: llc %s -march=genx64 -mcpu=XeHPG \
+; RUN: -finalizer-opts='-asmToConsole' -o /dev/null \
+; RUN: | grep -v options > %t.serial
+; RUN: llc %s -march=genx64 -mcpu=XeHPG \
+; RUN: -finalizer-opts='-asmToConsole -parallelFuncCompile 4' -o /dev/null \
+; RUN: | grep -v options > %t.parallel
+; RUN: diff %t.serial %t.parallel
+; RUN: FileCheck %s --input-file=%t.parallel
+
+; CHECK-DAG: S1
+; CHECK-DAG: S2
+; CHECK-DAG: S3
+; CHECK-DAG: S4
+
+target datalayout = "e-p:64:64-i64:64-n8:16:32:64"
+target triple = "genx64-unknown-unknown"
+
+declare <8 x i32> @llvm.genx.wrregioni.v8i32.v1i32.i16.i1(<8 x i32>, <1 x i32>, i32, i32, i32, i16, i32, i1)
+declare void @llvm.genx.media.st.v8i32(i32, i32, i32, i32, i32, i32, <8 x i32>)
+declare i32 @llvm.genx.rdregioni.i32.v8i32.i16(<8 x i32>, i32, i32, i32, i16, i32)
+
+define internal spir_func i32 @S1(<8 x i32> %v) unnamed_addr #0 !FuncArgSize !7 !FuncRetSize !8 {
+entry:
+  %e = tail call i32 @llvm.genx.rdregioni.i32.v8i32.i16(<8 x i32> %v, i32 0, i32 1, i32 1, i16 0, i32 undef)
+  %r = mul i32 %e, 3
+  ret i32 %r
+}
+
+define internal spir_func i32 @S2(<8 x i32> %v) unnamed_addr #0 !FuncArgSize !7 !FuncRetSize !8 {
+entry:
+  %e = tail call i32 @llvm.genx.rdregioni.i32.v8i32.i16(<8 x i32> %v, i32 0, i32 1, i32 1, i16 4, i32 undef)
+  %r = add i32 %e, 5
+  ret i32 %r
+}
+
+define internal spir_func i32 @S3(<8 x i32> %v) unnamed_addr #0 !FuncArgSize !7 !FuncRetSize !8 {
+entry:
+  %e = tail call i32 @llvm.genx.rdregioni.i32.v8i32.i16(<8 x i32> %v, i32 0, i32 1, i32 1, i16 8, i32 undef)
+  %r = xor i32 %e, 7
+  ret i32 %r
+}
+
+define internal spir_func i32 @S4(<8 x i32> %v) unnamed_addr #0 !FuncArgSize !7 !FuncRetSize !8 {
+entry:
+  %e = tail call i32 @llvm.genx.rdregioni.i32.v8i32.i16(<8 x i32> %v, i32 0, i32 1, i32 1, i16 12, i32 undef)
+  %r = shl i32 %e, 2
+  ret i32 %r
+}
+
+define dllexport spir_kernel void @K(i32 %buf) local_unnamed_addr #1 {
+entry:
+  %c1 = tail call spir_func i32 @S1(<8 x i32> <i32 1, i32 2, i32 3, i32 4, i32 5, i32 6, i32 7, i32 8>) #2, !FuncArgSize !7, !FuncRetSize !8
+  %c2 = tail call spir_func i32 @S2(<8 x i32> <i32 1, i32 2, i32 3, i32 4, i32 5, i32 6, i32 7, i32 8>) #2, !FuncArgSize !7, !FuncRetSize !8
+  %c3 = tail call spir_func i32 @S3(<8 x i32> <i32 1, i32 2, i32 3, i32 4, i32 5, i32 6, i32 7, i32 8>) #2, !FuncArgSize !7, !FuncRetSize !8
+  %c4 = tail call spir_func i32 @S4(<8 x i32> <i32 1, i32 2, i32 3, i32 4, i32 5, i32 6, i32 7, i32 8>) #2, !FuncArgSize !7, !FuncRetSize !8
+  %a1 = add i32 %c1, %c2
+  %a2 = add i32 %c3, %c4
+  %a = add i32 %a1, %a2
+  %s = insertelement <1 x i32> undef, i32 %a, i64 0
+  %w = tail call <8 x i32> @llvm.genx.wrregioni.v8i32.v1i32.i16.i1(<8 x i32> zeroinitializer, <1 x i32> %s, i32 0, i32 1, i32 0, i16 0, i32 undef, i1 true)
+  tail call void @llvm.genx.media.st.v8i32(i32 0, i32 %buf, i32 0, i32 32, i32 0, i32 0, <8 x i32> %w)
+  ret void
+}
+
+attributes #0 = { noinline nounwind readnone "CMStackCall" }
+attributes #1 = { noinline nounwind "CMGenxMain" }
+attributes #2 = { noinline nounwind }
+
+!genx.kernels = !{!0}
+!genx.kernel.internal = !{!5}
+
+!0 = !{void (i32)* @K, !"K", !1, i32 0, !2, !3, !4, i32 0}
+!1 = !{i32 2}
+!2 = !{i32 32}
+!3 = !{i32 0}
+!4 = !{!"buffer_t read_write"}
+!5 = !{void (i32)* @K, !3, !3, null, null}
+!7 = !{i32 1}
+!8 = !{i32 1}
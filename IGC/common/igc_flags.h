@@ -13,6 +13,7 @@ SPDX-License-Identifier: MIT
 
 DECLARE_IGC_GROUP("VISA optimization")
 DECLARE_IGC_REGKEY(DWORD, VISALTO,                          0, "vISA LTO optimization flags. check LINKER_TYPE for more details", false)
+DECLARE_IGC_REGKEY(DWORD, VISAParallelFuncCompile,          0, "Number of threads vISA uses to compile stack-call functions before linking them. 0 or 1 compiles them serially", false)
 DECLARE_IGC_REGKEY(bool, DisableSendS,                  false, "Setting this to 1/true adds a compiler switch to not generate sends commands, default is to enable sends ", false)
 DECLARE_IGC_REGKEY(bool, ForcePreserveR0,               false, "Setting this to true makes VISA preserve r0 in r0", true)
 DECLARE_IGC_REGKEY(bool, EnablePreemption,              true,  "Enable generating preeemptable code (SKL+)", false)
@@ -23,6 +24,7 @@ DECLARE_IGC_REGKEY(DWORD, VISAPreSchedCtrl,             0,     "Configure Pre-RA
 DECLARE_IGC_REGKEY(bool, ForceVISAPreSched,             false, "Force enabling of VISA Pre-RA Scheduler", false)
 DECLARE_IGC_REGKEY(DWORD, VISAPreSchedRPThreshold,      0,     "Threshold to commit a pre-RA Scheduling without spills, 0 for the default", false)
 DECLARE_IGC_REGKEY(DWORD, VISAPreSchedExtraGRF,         0,     "Bump up GRF number to make pre-RA Scheduling more greedy, 0 for the default", false)
+DECLARE_IGC_REGKEY(bool, VISAPreSchedSuperblock,        false, "Let VISA Pre-RA Scheduler hoist long-latency instructions across blocks within superblocks", false)
 DECLARE_IGC_REGKEY(DWORD, VISAScheduleStartBBID, 0,  "The ID of BB which will be first scheduled", false)
 DECLARE_IGC_REGKEY(DWORD, VISAScheduleEndBBID, 0,  "The ID of BB which will be last scheduled", false)
 DECLARE_IGC_REGKEY(DWORD, VISAPostScheduleStartBBID, 0,  "The ID of BB which will be first scheduled", false)
@@ -128,6 +130,16 @@ DECLARE_IGC_REGKEY(bool, DisableCodeSinking,            false, "Setting this to
 DECLARE_IGC_REGKEY(bool, DisableCodeSinkingInputVec,    false, "Setting this to 1/true disable sinking inputVec inst (test)", false)
 DECLARE_IGC_REGKEY(DWORD, LoopSinkMinSave,              5,  "If loop sink can have save more than this Minimum, do it; otherwise, skip", false)
 DECLARE_IGC_REGKEY(DWORD, LoopSinkThresholdDelta,       50,  "Do loop sink If the estimated register pressure is higher than this + #avaialble registers", false)
+DECLARE_IGC_REGKEY(bool, EnablePressureRematSched,      false, "Enable register pressure driven rematerialization and load sinking before vISA emission", false)
+DECLARE_IGC_REGKEY(DWORD, PressureRematSchedSIMD,       16,  "SIMD width the estimated pressure is scaled to in PressureRematSched", false)
+DECLARE_IGC_REGKEY(DWORD, PressureRematSchedBudget,     0,   "Pressure budget in bytes for PressureRematSched, 0 means the size of the GRF file", false)
+DECLARE_IGC_REGKEY(DWORD, PressureRematSchedMaxIter,    4,   "Max number of estimate/transform rounds done by PressureRematSched", false)
+DECLARE_IGC_REGKEY(bool, DumpPressureRematSched,        false, "Print estimated pressure before/after PressureRematSched and the number of transformations", false)
+DECLARE_IGC_REGKEY(bool, EnableLoopLoadPipelining,      false, "Enable software pipelining of loads by one iteration in single-block loops", false)
+DECLARE_IGC_REGKEY(DWORD, LoopLoadPipeliningSIMD,       16,  "SIMD width the estimated pressure is scaled to in LoopLoadPipelining", false)
+DECLARE_IGC_REGKEY(DWORD, LoopLoadPipeliningBudget,     0,   "Pressure budget in bytes for LoopLoadPipelining, 0 means the size of the GRF file", false)
+DECLARE_IGC_REGKEY(DWORD, LoopLoadPipeliningMaxLoads,   4,   "Max number of loads pipelined per loop by LoopLoadPipelining", false)
+DECLARE_IGC_REGKEY(DWORD, LoopLoadPipeliningMaxInsts,   500, "Max number of instructions in a loop considered by LoopLoadPipelining", false)
 DECLARE_IGC_REGKEY(bool, EnableLoopHoistConstant,       false, "Enables pass to check for specific loop patterns where variables are constant across all but the last iteration, and hoist them out of the loop.", false)
 DECLARE_IGC_REGKEY(bool, DisableCodeHoisting,           false, "Setting this to 1/true adds a compiler switch to disable code-hoisting", false)
 DECLARE_IGC_REGKEY(bool, EnableDeSSA,                   true,  "Setting this to 0/false adds a compiler switch to disable De-SSA", false)
@@ -181,6 +193,7 @@ DECLARE_IGC_REGKEY(DWORD,SetRegisterPressureThresholdForLoopUnroll,       96,
 DECLARE_IGC_REGKEY(DWORD,SetBranchSwapThreshold,        400,   "Set the branch swaping threshold.", false)
 DECLARE_IGC_REGKEY(debugString, LLVMCommandLine,        0,     "applies LLVM command line", false)
 DECLARE_IGC_REGKEY(debugString, SelectiveHashOptions,   0,     "applies options to hash ragne via string", false)
+DECLARE_IGC_REGKEY(debugString, TunedOptionsFile,       0,     "Per-shader options file in the Options.txt hash syntax, e.g. written by scripts/igc_tune.py", false)
 DECLARE_IGC_REGKEY(bool, DisableDX9LowPrecision,        true,  "Disables HF in DX9.", false)
 DECLARE_IGC_REGKEY(bool, EnablePingPongTextureOpt,      true,  "Enables the Ping Pong texture optimization which is used only for Compute Shaders for back to back dispatches", false)
 DECLARE_IGC_REGKEY(bool, EnableAtomicBranch,            false, "Enable Atomic branch optimization which break atomic into if/else with atomic and read based on the operation", false)
@@ -373,6 +386,7 @@ DECLARE_IGC_REGKEY(bool, AddExtraIntfInfo,                false, "Will add extra
 DECLARE_IGC_GROUP("Debugging features")
 DECLARE_IGC_REGKEY(debugString, ForceSpillVariables,            0,     "comma-separated string, each provide the declare id of variable which will be spilled", true)
 DECLARE_IGC_REGKEY(debugString, ForceAssignRhysicalReg,     0, "Force assigning dclId to phyiscal reg.", true)
+DECLARE_IGC_REGKEY(debugString, VISABlockProfile,           0,     "Path to a per-block execution count profile ('<kernel> <label> <count>' per line) used by vISA to move cold blocks out of the hot path", true)
 DECLARE_IGC_REGKEY(bool, InitializeUndefValueEnable,    false, "Setting this to 1/true initializes all undefs in URB payload to 0", false)
 DECLARE_IGC_REGKEY(bool, InitializeRegistersEnable,     false, "Setting this to 1/true initializes all GRFs, Flag and address registers to 0 at the beginning of the shader", false)
 DECLARE_IGC_REGKEY(bool, InitializeAddressRegistersBeforeUse,     false, "Setting this to 1 (true) initializes address register to 0 before each use", false)
@@ -384,6 +398,8 @@ DECLARE_IGC_REGKEY(bool, EnableWriteOldFPToStack,       true,  "Setting this to
 DECLARE_IGC_REGKEY(bool, ZeBinCompatibleDebugging,      true,  "Setting this to 1 (true) enables embed debug info in zeBinary", true)
 DECLARE_IGC_REGKEY(bool, DebugInfoEnforceAmd64EM,       false, "Enforces elf file with the debug infomation to have eMachine set to AMD64", false)
 DECLARE_IGC_REGKEY(bool, DebugInfoValidation,           false, "Enable optional (strict) checks to detect debug information inconsistencies", false)
+DECLARE_IGC_REGKEY(DWORD, DebugInfoShareTypes,           0, "Share struct/class/union/enum DIEs of at least this many bytes and the abbreviation table between the kernels of a program in zebinary. 0 disables sharing", false)
+DECLARE_IGC_REGKEY(bool, PrintDebugInfoShareTypes,       false, "Print how much debug info DebugInfoShareTypes saved for each program", false)
 DECLARE_IGC_REGKEY(bool, deadLoopForFloatException,           false, "enable a dead loop if float exception happened", false)
 DECLARE_IGC_REGKEY(debugString, ExtraOCLOptions,        0,     "Extra options for OpenCL", true)
 DECLARE_IGC_REGKEY(debugString, ExtraOCLInternalOptions, 0,    "Extra internal options for OpenCL", true)
@@ -606,11 +622,16 @@ DECLARE_IGC_REGKEY(DWORD, ParameterForColdFuncThreshold,        1, "C/10-STD for
 DECLARE_IGC_REGKEY(bool, ControlUnitSize,               false, "Control compilation unit size by unit trimming", true)
 DECLARE_IGC_REGKEY(DWORD, ExpandedUnitSizeThreshold,    50000, "Trimming target of compilation unit size", true)
 DECLARE_IGC_REGKEY(DWORD, PrintControlUnitSize,             0, "Print information about unit trimming", true)
+DECLARE_IGC_REGKEY(bool, ControlKernelCompileTime,      false, "Trim inlining until the estimated compile cost of each kernel is within KernelCompileTimeBudget", true)
+DECLARE_IGC_REGKEY(DWORD, KernelCompileTimeBudget,      500000000, "Compile cost budget of a kernel for ControlKernelCompileTime, in (instructions + blocks) x live ranges", true)
+DECLARE_IGC_REGKEY(DWORD, PrintKernelCompileTimeBudget,     0, "Print compile cost estimates (0x1) and trimming decisions (0x2) of ControlKernelCompileTime", true)
 DECLARE_IGC_REGKEY(bool, EnableConstantPromotion,       true, "Enable global constant data to register promotion", false)
 DECLARE_IGC_REGKEY(bool, AllowNonLoopConstantPromotion, false, "Allows promotion for constants not in loop (e.g. used once)", false)
 DECLARE_IGC_REGKEY(DWORD, ConstantPromotionSize,        2, "Threshold in number of GRFs", false)
 DECLARE_IGC_REGKEY(DWORD, ConstantPromotionCmpSelSize,  4, "Array size threshold for cmp-sel transform", false)
 DECLARE_IGC_REGKEY(bool, EnableVariableReuse,           true, "Enable local variable reuse", false)
+DECLARE_IGC_REGKEY(bool, PackUniformScalars,            false, "Pack long-lived uniform scalars defined in the entry block that share a live range into shared GRFs", false)
+DECLARE_IGC_REGKEY(bool, DumpUniformScalarPacking,      false, "Print per-function statistics of PackUniformScalars (packed scalars, GRFs used and scalars left unpacked)", false)
 DECLARE_IGC_REGKEY(bool, EnableVariableAlias,           true, "Enable variable aliases (part of VariableReuse Pass, but separate functionality)", false)
 DECLARE_IGC_REGKEY(DWORD, VATemp,                       0, "[temp]New code to replace code under EnableVATemp (removed already). Once stable, remove this.", false)
 DECLARE_IGC_REGKEY(bool, EnableExtractMask,             false, "When enabled, it is mostly for reducing response size of send messages.", false)
@@ -691,6 +712,7 @@ DECLARE_IGC_REGKEY(DWORD, EmulationFunctionControl,  0,  "FunctionControl on som
 DECLARE_IGC_REGKEY(DWORD, InlinedEmulationThreshold,    125000, "Inlined instruction threshold for enabling subroutines", false)
 DECLARE_IGC_REGKEY(int, ByPassAllocaSizeHeuristic,   0,  "Force some Alloca to pass the pressure heuristic until the given size", true)
 DECLARE_IGC_REGKEY(DWORD, MemOptWindowSize,   150,  "Size of the window in unit of instructions in which load/stores are allowed to be coalesced. Keep it limited in order to avoid creating long liveranges. Default value is 150", false)
+DECLARE_IGC_REGKEY(bool, EnableMemOptCrossBB, false, "Let MemOpt merge loads/stores across control-equivalent basic blocks (a block and the blocks it dominates and is post-dominated by in the same loop)", false)
 DECLARE_IGC_REGKEY(bool, ForceNoFP64bRegioning, false, "force regioning rules for FP and 64b FPU instructions", false)
 DECLARE_IGC_REGKEY(bool, EmitDebugLoc, true, "Enable generation of .debug_loc section", false)
 DECLARE_IGC_REGKEY(bool, EmitOffsetInDbgLoc, false, "Emit offset of private memory in DW_AT_location when available", false)
@@ -723,6 +745,7 @@ DECLARE_IGC_REGKEY(bool, EnableVector8LoadStore, false, "Enable Vectorizer to ge
 DECLARE_IGC_REGKEY(bool, EnableZEBinary, true,  "Force-enable output in ZE binary format. Leave unset for compiler to choose based on current platform's support for ZE binary", true)
 DECLARE_IGC_REGKEY(bool, ExcludeIRFromZEBinary, false, "Exclude IR sections from ZE binary", true)
 DECLARE_IGC_REGKEY(bool, AllocateZeroInitializedVarsInBss, true,  "Allocate zero initialized global variables in .bss section in ZEBinary", true)
+DECLARE_IGC_REGKEY(bool, EnableZEBinThroughputInfo, false, "Add the static throughput estimate of each kernel to ZE binary as a .misc.throughput.<kernel> section", true)
 DECLARE_IGC_REGKEY(DWORD, OverrideOCLMaxParamSize, 0,  "Override the value imposed on the kernel by CL_DEVICE_MAX_PARAMETER_SIZE. Value in bytes, if value==0 no override happens.", true)
 
 DECLARE_IGC_REGKEY(bool, EnableOptReportPrivateMemoryToSLM, false, "[POC] Generate opt report file for moving private memory allocations to SLM.", false)
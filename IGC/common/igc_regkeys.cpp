@@ -885,14 +885,14 @@ static void declareIGCKey(
     }
 }
 
-static void LoadDebugFlagsFromFile()
+static void LoadDebugFlagsFromFile(const std::string& fileName)
 {
-    std::ifstream input(GetOptionFile());
+    std::ifstream input(fileName);
     std::string line;
     std::vector<HashRange> hashes;
 
     if (input.is_open())
-        std::cout << std::endl << "** DebugFlags " << GetOptionFile() << " is opened" << std::endl;
+        std::cout << std::endl << "** DebugFlags " << fileName << " is opened" << std::endl;
 
     while (std::getline(input, line)) {
         if (line.empty() || line.front() == '#')
@@ -1113,9 +1113,16 @@ void LoadRegistryKeys(const std::string& options, bool *RegFlagNameError)
 #endif
         {
             //DumpIGCRegistryKeyDefinitions();
-            LoadDebugFlagsFromFile();
+            LoadDebugFlagsFromFile(GetOptionFile());
             LoadDebugFlagsFromString(IGC_GET_REGKEYSTRING(SelectiveHashOptions));
         }
+        // Best configurations found by the tuning driver. Their hash ranges are
+        // appended after the ones above and CheckHashRange picks the first
+        // match, so hand-written hash options still win for shaders they cover.
+        if (IGC_IS_FLAG_ENABLED(TunedOptionsFile))
+        {
+            LoadDebugFlagsFromFile(IGC_GET_REGKEYSTRING(TunedOptionsFile));
+        }
         if(IGC_IS_FLAG_ENABLED(LLVMCommandLine))
         {
             std::vector<char*> args;
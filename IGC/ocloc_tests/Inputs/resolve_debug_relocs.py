@@ -0,0 +1,82 @@
+# ========================== begin_copyright_notice ============================
+#
+# Copyright (C) 2024 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+# =========================== end_copyright_notice =============================
+
+# Applies the relocations of the debug sections of a zebinary the way a
+# debugger does (S + A, with R_ZE_SYM_ADDR and R_ZE_SYM_ADDR_32) and writes a
+# copy without them, so that llvm-dwarfdump, which has no relocation support
+# for EM_INTELGT, decodes the linked debug info.
+#
+#   resolve_debug_relocs.py <zebin> <output>
+
+import struct
+import sys
+
+SHT_SYMTAB = 2
+SHT_RELA = 4
+SHT_PROGBITS = 1
+R_ZE_SYM_ADDR = 1
+R_ZE_SYM_ADDR_32 = 2
+
+
+def main(src, dst):
+    with open(src, 'rb') as f:
+        elf = bytearray(f.read())
+
+    if elf[:4] != b'\x7fELF' or elf[4] != 2 or elf[5] != 1:
+        sys.exit('%s: expected a 64-bit little-endian ELF' % src)
+
+    shoff, = struct.unpack_from('<Q', elf, 0x28)
+    shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 0x3a)
+
+    headers = []
+    for i in range(shnum):
+        off = shoff + i * shentsize
+        name, type_, _, _, offset, size, link, info, _, entsize = \
+            struct.unpack_from('<IIQQQQIIQQ', elf, off)
+        headers.append((off, name, type_, offset, size, link, info, entsize))
+
+    strtab = headers[shstrndx]
+
+    def section_name(idx):
+        start = strtab[3] + headers[idx][1]
+        return elf[start:elf.index(b'\0', start)].decode()
+
+    applied = 0
+    for off, _, type_, offset, size, link, info, entsize in headers:
+        if type_ != SHT_RELA or not section_name(info).startswith('.debug'):
+            continue
+        symtab = headers[link]
+        assert symtab[2] == SHT_SYMTAB
+        target = headers[info][3]
+        for r in range(offset, offset + size, entsize):
+            r_offset, r_info, r_addend = struct.unpack_from('<QQq', elf, r)
+            sym = symtab[3] + (r_info >> 32) * symtab[7]
+            st_value, = struct.unpack_from('<Q', elf, sym + 8)
+            value = st_value + r_addend
+            rtype = r_info & 0xffffffff
+            if rtype == R_ZE_SYM_ADDR:
+                struct.pack_into('<Q', elf, target + r_offset, value)
+            elif rtype == R_ZE_SYM_ADDR_32:
+                struct.pack_into('<I', elf, target + r_offset,
+                                 value & 0xffffffff)
+            else:
+                sys.exit('%s: unexpected relocation type %d in %s' %
+                         (src, rtype, section_name(info)))
+            applied += 1
+        # The relocations are applied, keep readers from seeing them again.
+        struct.pack_into('<I', elf, off + 4, SHT_PROGBITS)
+
+    if not applied:
+        sys.exit('%s: no debug relocations found' % src)
+
+    with open(dst, 'wb') as f:
+        f.write(elf)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1], sys.argv[2])
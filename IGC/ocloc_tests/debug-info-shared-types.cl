@@ -0,0 +1,67 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+// REQUIRES: regkeys
+
+// With DebugInfoShareTypes, struct record is emitted by one kernel only and
+// the others refer to it with DW_FORM_ref_addr. The kernels have the same
+// shape, so the last one adds no abbreviations and reuses the table of the
+// kernel before it. All of it has to resolve in the zebinary, after the
+// kernel ELFs are linked with lld -r and the references to the named DIE and
+// abbreviation table symbols are rebased on the section symbols.
+
+// RUN: rm -rf %t && mkdir %t
+// RUN: ocloc compile -file %s -device dg2 \
+// RUN: -options "-g -cl-opt-disable -igc_opts 'DebugInfoShareTypes=1 PrintDebugInfoShareTypes=1'" \
+// RUN: -out_dir %t -output kernels -output_no_suffix 2>&1 \
+// RUN: | FileCheck %s --check-prefix=CHECK-STATS
+
+// CHECK-STATS:      Debug info shared between 3 kernels:
+// CHECK-STATS:      type DIEs exported: {{[1-9][0-9]*}}
+// CHECK-STATS-NEXT: type DIEs reused: {{[1-9][0-9]*}}
+// CHECK-STATS:      abbreviation tables emitted: 2 (
+// CHECK-STATS-NEXT: abbreviation tables reused: 1
+
+// No symbol of a shared DIE or abbreviation table is left in the zebinary.
+// RUN: llvm-readelf --symbols %t/kernels.bin \
+// RUN: | FileCheck %s --check-prefix=CHECK-SYMS --implicit-check-not=__igc_dbg_
+// CHECK-SYMS: Symbol table '.symtab'
+
+// The relocations are applied the way a debugger does before decoding.
+// RUN: %python %S/Inputs/resolve_debug_relocs.py %t/kernels.bin %t/resolved.elf
+// RUN: llvm-dwarfdump --debug-info --show-form %t/resolved.elf > %t/info.txt
+// RUN: FileCheck %s --input-file %t/info.txt --check-prefix=CHECK-DEF \
+// RUN: --implicit-check-not='("record")'
+// RUN: FileCheck %s --input-file %t/info.txt --check-prefix=CHECK-REF
+
+// CHECK-DEF:      DW_TAG_structure_type
+// CHECK-DEF-NEXT: DW_AT_name {{.*}}("record")
+
+// Each of the two other kernels refers to it from its pointer type and
+// from its local variable.
+// CHECK-REF-COUNT-4: DW_AT_type [DW_FORM_ref_addr] (0x{{[0-9a-f]+}} "record")
+
+struct record {
+  int ids[16];
+  float weights[16];
+};
+
+__kernel void first(__global struct record *in, __global int *out) {
+  struct record r = in[get_global_id(0)];
+  out[get_global_id(0)] = r.ids[1] + (int)r.weights[1];
+}
+
+__kernel void second(__global struct record *in, __global int *out) {
+  struct record r = in[get_global_id(0)];
+  out[get_global_id(0)] = r.ids[2] + (int)r.weights[2];
+}
+
+__kernel void third(__global struct record *in, __global int *out) {
+  struct record r = in[get_global_id(0)];
+  out[get_global_id(0)] = r.ids[3] + (int)r.weights[3];
+}
@@ -44,6 +44,9 @@ tool_dirs = [config.ocloc_dir, config.llvm_tools_dir, config.spirv_as_dir]
 if llvm_config.add_tool_substitutions([ToolSubst('ocloc', unresolved='break')], tool_dirs) is False:
   lit_config.note('Did not find ocloc in %s, ocloc will be used from system paths' % tool_dirs)
 
+llvm_config.add_tool_substitutions(['llvm-objcopy', 'llvm-readelf', 'llvm-dwarfdump'],
+                                   [config.llvm_tools_dir])
+
 if not config.regkeys_disabled:
   config.available_features.add('regkeys')
 
@@ -0,0 +1,52 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+// REQUIRES: regkeys
+
+// The static throughput estimate of the final code is written to the
+// .misc.throughput.<kernel> section of the zebin on request.
+
+// RUN: rm -rf %t && mkdir %t
+// RUN: ocloc compile -file %s -device dg2 \
+// RUN: -options "-igc_opts 'EnableZEBinThroughputInfo=1'" \
+// RUN: -out_dir %t -output kernels -output_no_suffix
+// RUN: llvm-objcopy --dump-section .misc.throughput.copy=%t/copy.txt \
+// RUN: --dump-section .misc.throughput.sum=%t/sum.txt %t/kernels.bin
+// RUN: FileCheck %s --input-file %t/copy.txt --check-prefix=CHECK-COPY
+// RUN: FileCheck %s --input-file %t/sum.txt --check-prefix=CHECK-SUM
+
+// The store has to wait on the token of the load.
+// CHECK-COPY:      cycles: {{[1-9][0-9]*}}
+// CHECK-COPY-NEXT: alu_cycles: {{[0-9]+}}
+// CHECK-COPY-NEXT: send_cycles: {{[1-9][0-9]*}}
+// CHECK-COPY-NEXT: sync_cycles: {{[1-9][0-9]*}}
+// CHECK-COPY-NEXT: bottleneck: {{alu|send|sync}}
+
+// CHECK-SUM:      cycles: {{[1-9][0-9]*}}
+// CHECK-SUM-NEXT: alu_cycles: {{[1-9][0-9]*}}
+// CHECK-SUM-NEXT: send_cycles: {{[1-9][0-9]*}}
+// CHECK-SUM-NEXT: sync_cycles: {{[0-9]+}}
+// CHECK-SUM-NEXT: bottleneck: {{alu|send|sync}}
+
+// The section is not emitted by default.
+// RUN: ocloc compile -file %s -device dg2 \
+// RUN: -out_dir %t -output default -output_no_suffix
+// RUN: not llvm-objcopy --dump-section .misc.throughput.copy=%t/none.txt \
+// RUN: %t/default.bin
+
+__kernel void copy(__global const int *src, __global int *dst) {
+  size_t i = get_global_id(0);
+  dst[i] = src[i];
+}
+
+__kernel void sum(__global const int *src, __global int *dst, int n) {
+  int acc = 0;
+  for (int i = 0; i < n; ++i)
+    acc += src[i] * i;
+  dst[get_global_id(0)] = acc;
+}
@@ -0,0 +1,46 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+// REQUIRES: regkeys
+
+// Uniform scalars defined in the entry block and used in the loop are placed
+// at aligned offsets of one shared GRF with PackUniformScalars. tail is also
+// live after the loop, so packing it would make the others live longer; it
+// keeps a declare of its own.
+
+// RUN: ocloc compile -file %s -device dg2 \
+// RUN: -options "-igc_opts 'PackUniformScalars=1 DumpVISAASMToConsole=1'" \
+// RUN: | FileCheck %s --check-prefix=CHECK-PACK
+// RUN: ocloc compile -file %s -device dg2 \
+// RUN: -options "-igc_opts 'PackUniformScalars=1 DumpUniformScalarPacking=1'" \
+// RUN: 2>&1 | FileCheck %s --check-prefix=CHECK-DUMP
+// RUN: ocloc compile -file %s -device dg2 \
+// RUN: -options "-igc_opts 'DumpVISAASMToConsole=1'" \
+// RUN: | FileCheck %s --check-prefix=CHECK-NOPACK
+
+// CHECK-PACK:     .decl [[PACK:UniformPack[^ ]*]] v_type=G type=ub num_elts={{[0-9]+}} align=GRF
+// CHECK-PACK-DAG: .decl {{[^ ]+}} v_type=G type={{[a-z]+}} num_elts=1 alias=<[[PACK]], 0>
+// CHECK-PACK-DAG: .decl {{[^ ]+}} v_type=G type={{[a-z]+}} num_elts=1 alias=<[[PACK]], 4>
+// CHECK-PACK-DAG: .decl {{[^ ]+}} v_type=G type={{[a-z]+}} num_elts=1 alias=<[[PACK]], 8>
+// CHECK-PACK-NOT: alias=<[[PACK]], 12>
+
+// CHECK-DUMP: UniformScalarPacking: packed SIMD{{[0-9]+}}: packed {{[0-9]+}} scalars
+// CHECK-DUMP-SAME: into 1 GRF(s), left {{[1-9][0-9]*}} scalar(s) with a live range of their own unpacked
+
+// CHECK-NOPACK-NOT: UniformPack
+
+__kernel void packed(__global int *dst, int a, int b, int n) {
+  int base = a * b;
+  int stride = a + b;
+  int limit = n - a;
+  int tail = a - b;
+  dst[tail] = 0;
+  for (int i = get_global_id(0); i < limit; i += stride)
+    dst[i] = base + i;
+  dst[1] = tail;
+}
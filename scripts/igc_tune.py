@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+
+#=========================== begin_copyright_notice ============================
+#
+# Copyright (C) 2024 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+#============================ end_copyright_notice =============================
+
+"""Per-shader tuning driver for IGC/vISA options.
+
+Compiles one shader under a list of regkey configurations in parallel, scores
+every configuration with the static vISA performance model (-perfmodel) and
+records the best one for the shader hash in a tuning file. The tuning file
+uses the Options.txt hash syntax, so later compilations pick it up through
+the TunedOptionsFile regkey:
+
+    IGC_TunedOptionsFile=/path/to/tuned.txt <compile command>
+
+Configuration file: one configuration per line, regkeys separated by ','
+(e.g. "VISAPreSchedCtrl=4,EnableLoopLoadPipelining=1"). Empty lines and lines
+starting with '#' are ignored. The default configuration is always scored as
+the baseline. Only numeric and boolean regkeys can be set per shader.
+
+Example:
+    igc_tune.py --hash 0x1a2b3c4d5e6f7081 --configs configs.txt \\
+        --output tuned.txt -- ocloc compile -file kernel.cl -device dg2
+"""
+
+import argparse
+import concurrent.futures
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PERF_KERNEL_RE = re.compile(r"^Kernel name: (.*)$")
+PERF_VALUE_RE = re.compile(r"^(Total|Fill|Spill) dyn inst: (\d+)$")
+
+
+def parse_hash(text):
+    value = int(text, 16)
+    if value < 0 or value >= 1 << 64:
+        raise argparse.ArgumentTypeError("invalid shader hash: " + text)
+    return value
+
+
+def read_configs(path):
+    configs = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            keys = [k.strip() for k in line.split(",") if k.strip()]
+            for key in keys:
+                if "=" not in key:
+                    sys.exit("malformed regkey '%s' in %s" % (key, path))
+            configs.append(keys)
+    return configs
+
+
+def parse_perf_model(output, shader_hash):
+    """Sum the perf model estimates of all kernels dumped for shader_hash.
+
+    Returns None if no kernel of the shader was reported."""
+    tag = "asm%016x" % shader_hash
+    result = None
+    current = None
+    for line in output.splitlines():
+        line = line.strip()
+        m = PERF_KERNEL_RE.match(line)
+        if m:
+            current = None
+            if tag in m.group(1):
+                if result is None:
+                    result = {"Total": 0, "Fill": 0, "Spill": 0}
+                current = result
+            continue
+        m = PERF_VALUE_RE.match(line)
+        if m and current is not None:
+            current[m.group(1)] += int(m.group(2))
+    return result
+
+
+def score(estimate, spill_weight):
+    # Spill and fill sends cost far more than the ALU instructions the model
+    # counts them as.
+    return estimate["Total"] + spill_weight * (estimate["Fill"] + estimate["Spill"])
+
+
+def run_config(command, shader_hash, keys, work_dir, timeout):
+    env = dict(os.environ)
+    env["IGC_EnableDebugging"] = "1"
+    env["IGC_ShaderDumpEnable"] = "1"
+    env["IGC_DumpToCustomDir"] = work_dir + os.sep
+    env["IGC_VISAOptions"] = (env.get("IGC_VISAOptions", "") + " -perfmodel").strip()
+    # Restrict the configuration to the shader being tuned.
+    if keys:
+        env["IGC_SelectiveHashOptions"] = ";".join(
+            ["hash:%016x" % shader_hash] + keys)
+    env.pop("IGC_TunedOptionsFile", None)
+
+    try:
+        proc = subprocess.run(command, cwd=work_dir, env=env,
+                              stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                              universal_newlines=True, timeout=timeout)
+    except subprocess.TimeoutExpired:
+        return None, "timed out"
+    if proc.returncode != 0:
+        return None, "exit code %d" % proc.returncode
+    estimate = parse_perf_model(proc.stdout, shader_hash)
+    if estimate is None:
+        return None, "no perf model output for the shader"
+    return estimate, None
+
+
+def read_tuning_file(path):
+    """Return {hash: [regkey lines]} for an existing tuning file."""
+    entries = {}
+    if not os.path.exists(path):
+        return entries
+    current = None
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            if line.startswith("hash:"):
+                current = entries.setdefault(parse_hash(line[len("hash:"):]), [])
+            elif current is not None:
+                current.append(line)
+    return entries
+
+
+def write_tuning_file(path, entries):
+    tmp = path + ".tmp"
+    with open(tmp, "w") as f:
+        f.write("# Per-shader options generated by igc_tune.py.\n")
+        f.write("# Use with IGC_TunedOptionsFile=%s\n" % os.path.abspath(path))
+        for shader_hash in sorted(entries):
+            f.write("hash:%016x\n" % shader_hash)
+            for key in entries[shader_hash]:
+                f.write(key + "\n")
+    os.replace(tmp, path)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--hash", type=parse_hash, required=True,
+                        help="asm hash of the shader to tune (hex)")
+    parser.add_argument("--configs", required=True,
+                        help="file with one regkey configuration per line")
+    parser.add_argument("--output", required=True,
+                        help="tuning file to update")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1,
+                        help="number of compilations run in parallel")
+    parser.add_argument("--spill-weight", type=int, default=10,
+                        help="cost of a spill/fill relative to other instructions")
+    parser.add_argument("--timeout", type=int, default=600,
+                        help="timeout of a single compilation in seconds")
+    parser.add_argument("--keep", action="store_true",
+                        help="keep the per-configuration dump directories")
+    parser.add_argument("command", nargs=argparse.REMAINDER,
+                        help="compile command, after '--'")
+    args = parser.parse_args()
+
+    command = args.command[1:] if args.command[:1] == ["--"] else args.command
+    if not command:
+        parser.error("missing compile command")
+
+    configs = [[]] + read_configs(args.configs)
+    root = tempfile.mkdtemp(prefix="igc_tune_")
+    work_dirs = []
+    for i in range(len(configs)):
+        work_dirs.append(os.path.join(root, "config%d" % i))
+        os.makedirs(work_dirs[-1])
+
+    results = [None] * len(configs)
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        futures = {
+            pool.submit(run_config, command, args.hash, keys, work_dirs[i],
+                        args.timeout): i
+            for i, keys in enumerate(configs)
+        }
+        for future in concurrent.futures.as_completed(futures):
+            i = futures[future]
+            estimate, error = future.result()
+            name = ",".join(configs[i]) or "<default>"
+            if error:
+                print("%-60s failed: %s" % (name, error))
+                continue
+            results[i] = score(estimate, args.spill_weight)
+            print("%-60s score %d (total %d, fill %d, spill %d)" % (
+                name, results[i], estimate["Total"], estimate["Fill"],
+                estimate["Spill"]))
+
+    if not args.keep:
+        shutil.rmtree(root, ignore_errors=True)
+
+    if results[0] is None:
+        sys.exit("the default configuration did not compile; nothing recorded")
+
+    best = 0
+    for i, result in enumerate(results):
+        if result is not None and result < results[best]:
+            best = i
+
+    entries = read_tuning_file(args.output)
+    if best == 0:
+        print("no configuration beats the default")
+        entries.pop(args.hash, None)
+    else:
+        print("best: %s (%d vs %d)" % (",".join(configs[best]), results[best],
+                                       results[0]))
+        entries[args.hash] = configs[best]
+    write_tuning_file(args.output, entries)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
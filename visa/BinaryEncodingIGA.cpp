@@ -1161,8 +1161,22 @@ void BinaryEncodingIGA::Encode() {
     if (kernel.getOption(vISA_EnableIGASWSB)) {
       encoder.enableIGAAutoDeps();
     }
+    encoder.enableFastEncode(kernel.getOption(vISA_IGAFastEncode));
+    encoder.enableVerifyFastEncode(kernel.getOption(vISA_IGAVerifyFastEncode));
+    encoder.enableMemoizeCompaction(
+        kernel.getOption(vISA_IGAMemoizeCompaction));
+    iga::EncoderStats encodeStats;
+    const bool dumpEncodeStats = kernel.getOption(vISA_dumpIGAEncodeStats);
+    if (dumpEncodeStats) {
+      encoder.setStats(&encodeStats);
+    }
 
     encoder.encode(kernel.fg.builder->criticalMsgStream());
+    if (dumpEncodeStats) {
+      kernel.fg.builder->criticalMsgStream()
+          << "  Kernel " << kernel.getName() << " IGA encoding:\n";
+      encodeStats.emit(kernel.fg.builder->criticalMsgStream());
+    }
 
     m_kernelBufferSize = encoder.getBinarySize();
     m_kernelBuffer = allocCodeBlock(m_kernelBufferSize);
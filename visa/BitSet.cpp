@@ -9,6 +9,22 @@ SPDX-License-Identifier: MIT
 #include "Assertions.h"
 #include "BitSet.h"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// The x86-64 baseline has no POPCNT, so __builtin_popcount is a libgcc call
+// per word. Where ifunc is available, emit a POPCNT clone of the popcount
+// loop as well and let the loader pick it on CPUs that support it.
+#if defined(__x86_64__) && defined(__GLIBC__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define BITSET_POPCNT_CLONES __attribute__((target_clones("popcnt", "default")))
+#endif
+#endif
+#ifndef BITSET_POPCNT_CLONES
+#define BITSET_POPCNT_CLONES
+#endif
+
 void BitSet::create(unsigned size) {
   const unsigned newArraySize =
       (size + NUM_BITS_PER_ELT - 1) / NUM_BITS_PER_ELT;
@@ -168,24 +184,50 @@ static BITSET_ARRAY_TYPE maskTrailingZeros(unsigned n) {
 // TODO: Use c++20 bit manipulation utility functions.
 static unsigned countTrailingZeros(BITSET_ARRAY_TYPE val) {
   vASSERT(val != 0);
-  unsigned count = 0;
-  while ((val & 1) == 0) {
-    val >>= 1;
-    ++count;
-  }
-  return count;
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward(&index, (unsigned long)val);
+  return index;
+#else
+  return __builtin_ctz(val);
+#endif
 }
 
 static unsigned countLeadingZeros(BITSET_ARRAY_TYPE val) {
   vASSERT(val != 0);
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanReverse(&index, (unsigned long)val);
+  return NUM_BITS_PER_ELT - 1 - index;
+#else
+  return __builtin_clz(val);
+#endif
+}
+
+static unsigned popCount(BITSET_ARRAY_TYPE val) {
+#if defined(_MSC_VER)
+  val = val - ((val >> 1) & 0x55555555);
+  val = (val & 0x33333333) + ((val >> 2) & 0x33333333);
+  return (((val + (val >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+#else
+  return __builtin_popcount(val);
+#endif
+}
+
+BITSET_POPCNT_CLONES
+static unsigned countBits(const BITSET_ARRAY_TYPE *words, unsigned n) {
   unsigned count = 0;
-  while ((val & (1 << (NUM_BITS_PER_ELT - 1))) == 0) {
-    val <<= 1;
-    ++count;
+  for (unsigned i = 0; i < n; i++) {
+    count += popCount(words[i]);
   }
   return count;
 }
 
+unsigned BitSet::count() const {
+  unsigned arraySize = (m_Size + NUM_BITS_PER_ELT - 1) / NUM_BITS_PER_ELT;
+  return countBits(m_BitSetArray, arraySize);
+}
+
 int BitSet::findFirstIn(unsigned begin, unsigned end) const {
   vASSERT(begin <= end && end <= m_Size);
   if (begin == end)
@@ -703,6 +703,16 @@ private:
   void summarizeFunctionInfo(
       KernelListTy &mainFunctions, KernelListTy &subFunctions);
 
+  // Compile the given stack-call functions on up to vISA_ParallelFuncCompile
+  // threads. Returns the first failing status in list order so the result
+  // doesn't depend on scheduling.
+  int compileFunctionsInParallel(const std::vector<VISAKernelImpl *> &funcs);
+
+  // Return true if deferring the stack-call functions until all kernels are
+  // compiled, and compiling them concurrently, sees the same values of the
+  // options that compiling a unit may update as compiling in list order.
+  bool canDeferFunctionCompile(bool isInPatchingMode);
+
   vISA::G4_Kernel *GetCallerKernel(vISA::G4_INST *);
   vISA::G4_Kernel *GetCalleeKernel(vISA::G4_INST *);
 
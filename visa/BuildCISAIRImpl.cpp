@@ -28,6 +28,8 @@ SPDX-License-Identifier: MIT
 #include "IGC/common/StringMacros.hpp"
 #include "MetadataDumpRA.h"
 
+#include <atomic>
+#include <exception>
 #include <fstream>
 #include <functional>
 #include <iostream>
@@ -36,6 +38,7 @@ SPDX-License-Identifier: MIT
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
 
 // clang-format off
 #include "common/LLVMWarningsPush.hpp"
@@ -1529,6 +1532,94 @@ int CISA_IR_Builder::ParseVISAText(const std::string &visaFile) {
 // compilation. Currently it is a .isa file.
 // TODO: Remove the ostream parameter used to emit visa binary.
 // default size of the kernel mem manager in bytes
+// Compiling a unit may turn vISA_EnableScalarJmp off (c.f.
+// FlowGraph::constructFlowGraph) and vISA_LSCBackupMode on (c.f.
+// Optimizer::insertFenceAtEntry) for all units compiled after it.
+static bool disablesScalarJmp(VISAKernelImpl *unit) {
+  IR_Builder *builder = unit->getIRBuilder();
+  return builder->hasFusedEU() && !builder->getOption(vISA_KeepScalarJmp) &&
+         unit->getKernel()->getInt32KernelAttr(Attributes::ATTR_Target) ==
+             VISA_CM;
+}
+
+static bool enablesLSCBackupMode(VISAKernelImpl *unit) {
+  IR_Builder *builder = unit->getIRBuilder();
+  return builder->getOption(vISA_InjectEntryFences) ||
+         (unit->getKernel()->getInt32KernelAttr(Attributes::ATTR_Target) ==
+              VISA_CM &&
+          VISA_WA_CHECK(builder->getPWaTable(), Wa_14010198302));
+}
+
+// Replay those updates in list order. Deferred functions all see the values
+// the options end up with, which is only what a compile in list order gives
+// if the first function already sees them.
+bool CISA_IR_Builder::canDeferFunctionCompile(bool isInPatchingMode) {
+  bool scalarJmp = m_options.getOption(vISA_EnableScalarJmp);
+  bool backupMode = m_options.getOption(vISA_LSCBackupMode);
+  bool seenFunction = false;
+  bool scalarJmpAtFirstFunc = scalarJmp, backupModeAtFirstFunc = backupMode;
+  for (VISAKernelImpl *unit : m_kernelsAndFunctions) {
+    if ((unit->getIsKernel() && isInPatchingMode) ||
+        (unit->getvIsaInstCount() == 0 && unit->getIsPayload()))
+      continue;
+    scalarJmp = scalarJmp && !disablesScalarJmp(unit);
+    backupMode = backupMode || enablesLSCBackupMode(unit);
+    if (unit->getIsFunction() && !seenFunction) {
+      seenFunction = true;
+      scalarJmpAtFirstFunc = scalarJmp;
+      backupModeAtFirstFunc = backupMode;
+    }
+  }
+  return seenFunction && scalarJmp == scalarJmpAtFirstFunc &&
+         backupMode == backupModeAtFirstFunc;
+}
+
+int CISA_IR_Builder::compileFunctionsInParallel(
+    const std::vector<VISAKernelImpl *> &funcs) {
+  // Apply the functions' updates of the shared options up front, so the
+  // workers only ever read them. canDeferFunctionCompile has checked that
+  // this doesn't change the value any function sees.
+  for (auto func : funcs) {
+    if (disablesScalarJmp(func))
+      m_options.setOptionInternally(vISA_EnableScalarJmp, false);
+    if (enablesLSCBackupMode(func))
+      m_options.setOptionInternally(vISA_LSCBackupMode, true);
+  }
+
+  unsigned numThreads = std::min<unsigned>(
+      m_options.getuInt32Option(vISA_ParallelFuncCompile), (unsigned)funcs.size());
+  std::vector<int> status(funcs.size(), VISA_SUCCESS);
+  std::vector<std::exception_ptr> errors(funcs.size());
+  std::atomic<size_t> next{0};
+
+  auto worker = [&](bool isMainThread) {
+    if (!isMainThread)
+      disableTimersOnThisThread();
+    for (size_t i = next++; i < funcs.size(); i = next++) {
+      try {
+        status[i] = funcs[i]->compileFastPath();
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned i = 1; i < numThreads; i++)
+    threads.emplace_back(worker, false);
+  worker(true);
+  for (auto &t : threads)
+    t.join();
+
+  for (size_t i = 0; i < funcs.size(); i++) {
+    if (errors[i])
+      std::rethrow_exception(errors[i]);
+    if (status[i] != VISA_SUCCESS)
+      return status[i];
+  }
+  return VISA_SUCCESS;
+}
+
 int CISA_IR_Builder::Compile(const char *nameInput, std::ostream *os,
                              bool emit_visa_only) {
   stopTimer(
@@ -1649,6 +1740,15 @@ int CISA_IR_Builder::Compile(const char *nameInput, std::ostream *os,
     uint32_t localScheduleEndKernelId =
         m_options.getuInt32Option(vISA_LocalScheduleingEndKernel);
     VISAKernelImpl *mainKernel = nullptr;
+    // Stack-call functions are independent units until they are stitched, so
+    // they may be compiled on worker threads once all kernels are done.
+    // forceBCR is cleared by the first RA that consumes it, which only gives
+    // a deterministic result when compiling in order.
+    bool parallelFuncCompile =
+        m_options.getuInt32Option(vISA_ParallelFuncCompile) > 1 &&
+        !m_options.getOption(vISA_forceBCR) &&
+        canDeferFunctionCompile(isInPatchingMode);
+    std::vector<VISAKernelImpl *> deferredFuncs;
     KernelListTy::iterator iter = kernel_begin();
     KernelListTy::iterator iend = kernel_end();
     for (int i = 0; iter != iend; iter++, i++) {
@@ -1705,6 +1805,10 @@ int CISA_IR_Builder::Compile(const char *nameInput, std::ostream *os,
           (kernel->getvIsaInstCount() == 0 && kernel->getIsPayload())) {
         continue;
       }
+      if (parallelFuncCompile && kernel->getIsFunction()) {
+        deferredFuncs.push_back(kernel);
+        continue;
+      }
       int status = kernel->compileFastPath();
       if (status != VISA_SUCCESS) {
         stopTimer(TimerID::TOTAL);
@@ -1728,6 +1832,14 @@ int CISA_IR_Builder::Compile(const char *nameInput, std::ostream *os,
         }
       }
     }
+    if (!deferredFuncs.empty()) {
+      int status = compileFunctionsInParallel(deferredFuncs);
+      if (status != VISA_SUCCESS) {
+        stopTimer(TimerID::TOTAL);
+        return status == VISA_EARLY_EXIT ? VISA_SUCCESS : status;
+      }
+    }
+
     // Here we change the payload section as the main kernel in
     // m_kernelsAndFunctions During stitching, all functions will be cloned and
     // stitched to the main kernel. Demoting the shader body to a function type
@@ -2215,6 +2215,10 @@ public:
   G4_INST *translateLscFence(G4_Predicate *pred, SFID sfid,
                              LSC_FENCE_OP fenceOp, LSC_SCOPE scope,
                              int &status);
+  // Set while creating UGM fences that must not be routed by the LSC backup
+  // mode even if vISA_LSCBackupMode is on. The options are shared by all
+  // kernels, so they can't be toggled for this.
+  bool noLscBackupModeFence = false;
 
   G4_INST *translateLscFence(G4_Predicate *pred, SFID sfid,
                              LSC_FENCE_OP fenceOp, LSC_SCOPE scope) {
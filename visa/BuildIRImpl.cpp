@@ -6,6 +6,7 @@ SPDX-License-Identifier: MIT
 
 ============================= end_copyright_notice ===========================*/
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <list>
@@ -793,7 +794,8 @@ IR_Builder::~IR_Builder() {
 G4_Declare *
 IR_Builder::cloneDeclare(std::map<G4_Declare *, G4_Declare *> &dclMap,
                          G4_Declare *dcl) {
-  static int uid = 0;
+  // shared by all kernels, which may be compiled concurrently
+  static std::atomic<int> uid{0};
   const char *newDclName =
       getNameString(16, "copy_%d_%s", uid++, dcl->getName());
   return dclpool.cloneDeclare(kernel, dclMap, newDclName, dcl);
@@ -861,10 +861,10 @@ template <class T> void emitDataUInt8(uint8_t data, T &t) {
   insertData(&data, sizeof(uint8_t), t);
 }
 
-template <class T>
-void emitDataVarLiveInterval(VISAKernelImpl *visaKernel,
-                             LiveIntervalInfo *lrInfo, uint32_t i,
-                             uint16_t size, T &t) {
+// Collect the live intervals of variable i of the kernel, sorted by start.
+static void collectVarLiveIntervals(VISAKernelImpl *visaKernel,
+                                    LiveIntervalInfo *lrInfo, uint32_t i,
+                                    std::vector<DebugInfoLiveInterval> &out) {
   // given lrs and saverestore, prepare assembled list of ranges to write out
   KernelDebugInfo *dbgInfo = visaKernel->getKernel()->getKernelDebugInfo();
 
@@ -873,87 +873,115 @@ void emitDataVarLiveInterval(VISAKernelImpl *visaKernel,
   if (lrInfo) {
     lrInfo->getLiveIntervals(lrs);
   }
-  uint16_t numLRs = (uint16_t)lrs.size();
   std::sort(lrs.begin(), lrs.end(),
             [](std::pair<uint32_t, uint32_t> &a,
                std::pair<uint32_t, uint32_t> &b) { return a.first < b.first; });
-  emitDataUInt16(numLRs, t);
+  out.reserve(lrs.size());
   for (auto &it : lrs) {
-    const uint32_t start = (uint32_t)it.first;
-    const uint32_t end = (uint32_t)it.second;
-
-    if (size == 2) {
-      emitDataUInt16((uint16_t)start, t);
-      emitDataUInt16((uint16_t)end, t);
-    } else {
-      emitDataUInt32(start, t);
-      emitDataUInt32(end, t);
-    }
+    DebugInfoLiveInterval lr;
+    lr.start = it.first;
+    lr.end = it.second;
 
     auto &varsMap = dbgInfo->getVarsMap();
-    const unsigned char virtualType = varsMap[i]->virtualType;
-    // Write virtual register type
-    emitDataUInt8((uint8_t)virtualType, t);
-
-    const unsigned char physicalType = varsMap[i]->physicalType;
-    // Write physical register type
-    emitDataUInt8((uint8_t)physicalType, t);
+    lr.virtualType = varsMap[i]->virtualType;
+    lr.physicalType = varsMap[i]->physicalType;
 
-    // If physical register assigned then write register number and
-    // sub-register number. Else write memory spill offset.
-    if (physicalType == VARMAP_PREG_FILE_MEMORY) {
+    // If physical register assigned then record register number and
+    // sub-register number. Else record memory spill offset.
+    if (lr.physicalType == VARMAP_PREG_FILE_MEMORY) {
       unsigned int memOffset =
           (unsigned int)varsMap[i]->Mapping.Memory.memoryOffset;
       if (visaKernel->getKernel()->fg.getHasStackCalls() == false) {
         memOffset |= 0x80000000;
       }
-      // Emit memory offset
-      emitDataUInt32((uint32_t)memOffset, t);
+      lr.memOffset = memOffset;
     } else {
-      const unsigned int regNum = varsMap[i]->Mapping.Register.regNum;
-      const unsigned int subRegNum = varsMap[i]->Mapping.Register.subRegNum;
-
-      // Emit register number
-      emitDataUInt16((uint16_t)regNum, t);
-
-      // Emit sub-register number
-      emitDataUInt16((uint16_t)subRegNum, t);
+      lr.regNum = (uint16_t)varsMap[i]->Mapping.Register.regNum;
+      lr.subRegNum = (uint16_t)varsMap[i]->Mapping.Register.subRegNum;
     }
+    out.push_back(lr);
   }
 }
 
 template <class T>
-void emitFrameDescriptorOffsetLiveInterval(
-    LiveIntervalInfo *lrInfo, uint32_t memOffset,
-    T &t) {
-  // Used to emit fields of Frame Descriptor
-  // location = [start, end) @ BE_FP+offset
-  std::vector<std::pair<uint32_t, uint32_t>> lrs;
-  if (lrInfo)
-    lrInfo->getLiveIntervals(lrs);
-  else
-    return;
+void emitDataLiveInterval(const DebugInfoLiveInterval &lr, uint16_t size,
+                          T &t) {
+  if (size == 2) {
+    emitDataUInt16((uint16_t)lr.start, t);
+    emitDataUInt16((uint16_t)lr.end, t);
+  } else {
+    emitDataUInt32(lr.start, t);
+    emitDataUInt32(lr.end, t);
+  }
 
-  uint32_t start = 0, end = 0;
-  if (lrs.size() > 0) {
-    start = lrs.front().first;
-    end = lrs.back().second;
+  // Write virtual register type
+  emitDataUInt8(lr.virtualType, t);
+
+  // Write physical register type
+  emitDataUInt8(lr.physicalType, t);
+
+  if (lr.physicalType == VARMAP_PREG_FILE_MEMORY) {
+    // Emit memory offset
+    emitDataUInt32(lr.memOffset, t);
+  } else {
+    // Emit register number
+    emitDataUInt16(lr.regNum, t);
+
+    // Emit sub-register number
+    emitDataUInt16(lr.subRegNum, t);
   }
+}
 
-  std::sort(lrs.begin(), lrs.end(),
-            [](std::pair<uint32_t, uint32_t> &a,
-               std::pair<uint32_t, uint32_t> &b) { return a.first < b.first; });
+template <class T>
+void emitDataVarLiveInterval(VISAKernelImpl *visaKernel,
+                             LiveIntervalInfo *lrInfo, uint32_t i,
+                             uint16_t size, T &t) {
+  std::vector<DebugInfoLiveInterval> lrs;
+  collectVarLiveIntervals(visaKernel, lrInfo, i, lrs);
+  emitDataUInt16((uint16_t)lrs.size(), t);
+  for (auto &lr : lrs) {
+    emitDataLiveInterval(lr, size, t);
+  }
+}
 
-  emitDataUInt16(1, t);
+static void sinkVarLiveIntervals(VISAKernelImpl *visaKernel,
+                                 LiveIntervalInfo *lrInfo, uint32_t i,
+                                 DebugInfoSink &sink) {
+  std::vector<DebugInfoLiveInterval> lrs;
+  collectVarLiveIntervals(visaKernel, lrInfo, i, lrs);
+  for (auto &lr : lrs) {
+    sink.addLiveInterval(lr);
+  }
+}
 
-  emitDataUInt32(start, t);
-  emitDataUInt32(end, t);
+// Fields of Frame Descriptor are described by a single interval
+// location = [start, end) @ BE_FP+offset
+static DebugInfoLiveInterval
+getFrameDescriptorLiveInterval(LiveIntervalInfo *lrInfo, uint32_t memOffset) {
+  std::vector<std::pair<uint32_t, uint32_t>> lrs;
+  lrInfo->getLiveIntervals(lrs);
 
-  emitDataUInt8((uint8_t)VARMAP_PREG_FILE_GRF, t);
+  DebugInfoLiveInterval lr;
+  if (lrs.size() > 0) {
+    lr.start = lrs.front().first;
+    lr.end = lrs.back().second;
+  }
+  lr.virtualType = VARMAP_PREG_FILE_GRF;
+  lr.physicalType = VARMAP_PREG_FILE_MEMORY;
+  lr.memOffset = memOffset;
+  return lr;
+}
 
-  emitDataUInt8((uint8_t)VARMAP_PREG_FILE_MEMORY, t);
+template <class T>
+void emitFrameDescriptorOffsetLiveInterval(
+    LiveIntervalInfo *lrInfo, uint32_t memOffset,
+    T &t) {
+  if (!lrInfo)
+    return;
 
-  emitDataUInt32(memOffset, t);
+  emitDataUInt16(1, t);
+  emitDataLiveInterval(getFrameDescriptorLiveInterval(lrInfo, memOffset),
+                       sizeof(uint32_t), t);
 }
 
 void populateUniqueSubs(G4_Kernel *kernel,
@@ -986,14 +1014,20 @@ void populateUniqueSubs(G4_Kernel *kernel,
   }
 }
 
-template <class T> void emitDataSubroutines(VISAKernelImpl *visaKernel, T &t) {
-  auto kernel = visaKernel->getKernel();
+struct SubroutineDebugInfo {
+  const char *name;
+  uint32_t startVISAIndex;
+  uint32_t endVISAIndex;
+  G4_Declare *retval;
+};
+
+static void collectSubroutines(G4_Kernel *kernel,
+                               std::vector<SubroutineDebugInfo> &subs) {
   // map<Label, Written to t>
   std::unordered_map<G4_BB *, bool> uniqueSubs;
 
   populateUniqueSubs(kernel, uniqueSubs);
-
-  emitDataUInt16((uint16_t)uniqueSubs.size(), t);
+  subs.reserve(uniqueSubs.size());
 
   kernel->fg.setPhysicalPredSucc();
   for (auto bb : kernel->fg) {
@@ -1037,64 +1071,93 @@ template <class T> void emitDataSubroutines(VISAKernelImpl *visaKernel, T &t) {
                          ->getRootDeclare();
           }
         }
-        emitDataName(subLabel->getLabel(), t);
-        emitDataUInt32(start, t);
-        emitDataUInt32(end, t);
-
-        if (kernel->getKernelDebugInfo()->getLiveIntervalInfo(retval, false) !=
-            NULL) {
-          auto lv =
-              kernel->getKernelDebugInfo()->getLiveIntervalInfo(retval, false);
-          uint32_t idx = kernel->getKernelDebugInfo()->getVarIndex(retval);
-          emitDataVarLiveInterval(visaKernel, lv, idx, sizeof(uint16_t), t);
-        } else {
-          emitDataUInt16(0, t);
-        }
+        subs.push_back({subLabel->getLabel(), start, end, retval});
       }
     }
   }
 }
 
-template <class T>
-void emitDataPhyRegSaveInfoPerIP(VISAKernelImpl *visaKernel,
-                                 SaveRestoreManager &mgr, T &t) {
+template <class T> void emitDataSubroutines(VISAKernelImpl *visaKernel, T &t) {
+  auto kernel = visaKernel->getKernel();
+  std::vector<SubroutineDebugInfo> subs;
+  collectSubroutines(kernel, subs);
+
+  emitDataUInt16((uint16_t)subs.size(), t);
+
+  for (auto &sub : subs) {
+    emitDataName(sub.name, t);
+    emitDataUInt32(sub.startVISAIndex, t);
+    emitDataUInt32(sub.endVISAIndex, t);
+
+    auto lv =
+        kernel->getKernelDebugInfo()->getLiveIntervalInfo(sub.retval, false);
+    if (lv != NULL) {
+      uint32_t idx = kernel->getKernelDebugInfo()->getVarIndex(sub.retval);
+      emitDataVarLiveInterval(visaKernel, lv, idx, sizeof(uint16_t), t);
+    } else {
+      emitDataUInt16(0, t);
+    }
+  }
+}
+
+struct RegSaveDebugInfo {
+  uint32_t genIPOffset;
+  std::vector<DebugInfoRegSaveMapping> mappings;
+};
+
+static void collectPhyRegSaveInfoPerIP(VISAKernelImpl *visaKernel,
+                                       SaveRestoreManager &mgr,
+                                       std::vector<RegSaveDebugInfo> &out) {
   auto &srInfo = mgr.getSRInfo();
   auto relocOffset =
       visaKernel->getKernel()->getKernelDebugInfo()->getRelocOffset();
   const IR_Builder *builder = visaKernel->getIRBuilder();
 
-  for (auto sr : srInfo) {
+  for (auto &sr : srInfo) {
     if (sr.getInst()->getGenOffset() == UNDEFINED_GEN_OFFSET) {
       continue;
     }
 
-    emitDataUInt32((uint32_t)sr.getInst()->getGenOffset() +
-                       getBinInstSize(sr.getInst()) - relocOffset,
-                   t);
-    emitDataUInt16((uint16_t)sr.saveRestoreMap.size(), t);
-    for (auto mapIt : sr.saveRestoreMap) {
-      emitDataUInt16((uint16_t)mapIt.first * builder->numEltPerGRF<Type_UB>(),
-                     t);
-      emitDataUInt16((uint16_t)builder->numEltPerGRF<Type_UB>(), t);
-
+    RegSaveDebugInfo info;
+    info.genIPOffset = (uint32_t)sr.getInst()->getGenOffset() +
+                       getBinInstSize(sr.getInst()) - relocOffset;
+    info.mappings.reserve(sr.saveRestoreMap.size());
+    for (auto &mapIt : sr.saveRestoreMap) {
+      DebugInfoRegSaveMapping mapping;
+      mapping.srcRegOff =
+          (uint16_t)mapIt.first * builder->numEltPerGRF<Type_UB>();
+      mapping.numBytes = (uint16_t)builder->numEltPerGRF<Type_UB>();
       if (mapIt.second.first == SaveRestoreInfo::RegOrMem::Reg) {
+        mapping.dstInReg = true;
+        mapping.dstRegNum = (uint16_t)mapIt.second.second.regNum;
+      } else {
+        // MemOffBEFP and MemAbs are both emitted as the raw offset.
+        mapping.dstInReg = false;
+        mapping.dstMemOffset = (uint32_t)mapIt.second.second.memOff;
+      }
+      info.mappings.push_back(mapping);
+    }
+    out.push_back(std::move(info));
+  }
+}
+
+template <class T>
+void emitDataPhyRegSaveInfo(const std::vector<RegSaveDebugInfo> &entries,
+                            T &t) {
+  emitDataUInt16((uint16_t)entries.size(), t);
+  for (auto &entry : entries) {
+    emitDataUInt32(entry.genIPOffset, t);
+    emitDataUInt16((uint16_t)entry.mappings.size(), t);
+    for (auto &mapping : entry.mappings) {
+      emitDataUInt16(mapping.srcRegOff, t);
+      emitDataUInt16(mapping.numBytes, t);
+      if (mapping.dstInReg) {
         emitDataUInt8((uint8_t)1, t);
-        emitDataUInt16((uint16_t)mapIt.second.second.regNum, t);
+        emitDataUInt16(mapping.dstRegNum, t);
         emitDataUInt16((uint16_t)0, t);
-      } else if (mapIt.second.first == SaveRestoreInfo::RegOrMem::MemOffBEFP) {
-        SaveRestoreInfo::RegMap tmp;
-        emitDataUInt8((uint8_t)0, t);
-        tmp = mapIt.second.second;
-        tmp.isAbs = 0;
-        uint32_t data = mapIt.second.second.memOff;
-        emitDataUInt32(data, t);
-      } else if (mapIt.second.first == SaveRestoreInfo::RegOrMem::MemAbs) {
-        SaveRestoreInfo::RegMap tmp;
+      } else {
         emitDataUInt8((uint8_t)0, t);
-        tmp = mapIt.second.second;
-        tmp.isAbs = 1;
-        uint32_t data = mapIt.second.second.memOff;
-        emitDataUInt32(data, t);
+        emitDataUInt32(mapping.dstMemOffset, t);
       }
     }
   }
@@ -1178,11 +1241,10 @@ void SaveRestoreManager::sieveInstructions(CallerOrCallee c) {
   }
 }
 
-template <class T> void emitDataCallerSave(VISAKernelImpl *visaKernel, T &t) {
+static void collectCallerSave(VISAKernelImpl *visaKernel,
+                              std::vector<RegSaveDebugInfo> &out) {
   auto kernel = visaKernel->getKernel();
 
-  uint16_t numCallerSaveEntries = 0;
-  // Compute total caller save entries to emit
   for (auto bbs : kernel->fg) {
     if (bbs->size() > 0 &&
         kernel->getKernelDebugInfo()->isFcallWithSaveRestore(bbs)) {
@@ -1200,48 +1262,15 @@ template <class T> void emitDataCallerSave(VISAKernelImpl *visaKernel, T &t) {
         mgr.addInst(callerRestore);
       }
 
-      auto &srInfo = mgr.getSRInfo();
-
       mgr.sieveInstructions(SaveRestoreManager::CallerOrCallee::Caller);
 
-      numCallerSaveEntries += (uint16_t)srInfo.size();
-      for (auto sr : srInfo) {
-        if (sr.getInst()->getGenOffset() == UNDEFINED_GEN_OFFSET) {
-          numCallerSaveEntries--;
-        }
-      }
-    }
-  }
-
-  emitDataUInt16(numCallerSaveEntries, t);
-
-  if (numCallerSaveEntries > 0) {
-    for (auto bbs : kernel->fg) {
-      if (bbs->size() > 0 &&
-          kernel->getKernelDebugInfo()->isFcallWithSaveRestore(bbs)) {
-        auto &callerSaveInsts =
-            kernel->getKernelDebugInfo()->getCallerSaveInsts(bbs);
-        auto &callerRestoreInsts =
-            kernel->getKernelDebugInfo()->getCallerRestoreInsts(bbs);
-
-        SaveRestoreManager mgr(visaKernel);
-        for (auto callerSave : callerSaveInsts) {
-          mgr.addInst(callerSave);
-        }
-
-        for (auto callerRestore : callerRestoreInsts) {
-          mgr.addInst(callerRestore);
-        }
-
-        mgr.sieveInstructions(SaveRestoreManager::CallerOrCallee::Caller);
-
-        emitDataPhyRegSaveInfoPerIP(visaKernel, mgr, t);
-      }
+      collectPhyRegSaveInfoPerIP(visaKernel, mgr, out);
     }
   }
 }
 
-template <class T> void emitDataCalleeSave(VISAKernelImpl *visaKernel, T &t) {
+static void collectCalleeSave(VISAKernelImpl *visaKernel,
+                              std::vector<RegSaveDebugInfo> &out) {
   G4_Kernel *kernel = visaKernel->getKernel();
 
   SaveRestoreManager mgr(visaKernel);
@@ -1254,21 +1283,21 @@ template <class T> void emitDataCalleeSave(VISAKernelImpl *visaKernel, T &t) {
     mgr.addInst(calleeRestore);
   }
 
-  uint16_t numCalleeSaveEntries = 0;
-  auto &srInfo = mgr.getSRInfo();
-
   mgr.sieveInstructions(SaveRestoreManager::CallerOrCallee::Callee);
 
-  numCalleeSaveEntries += (uint16_t)srInfo.size();
-  for (auto sr : srInfo) {
-    if (sr.getInst()->getGenOffset() == UNDEFINED_GEN_OFFSET) {
-      numCalleeSaveEntries--;
-    }
-  }
+  collectPhyRegSaveInfoPerIP(visaKernel, mgr, out);
+}
 
-  emitDataUInt16(numCalleeSaveEntries, t);
+template <class T> void emitDataCallerSave(VISAKernelImpl *visaKernel, T &t) {
+  std::vector<RegSaveDebugInfo> entries;
+  collectCallerSave(visaKernel, entries);
+  emitDataPhyRegSaveInfo(entries, t);
+}
 
-  emitDataPhyRegSaveInfoPerIP(visaKernel, mgr, t);
+template <class T> void emitDataCalleeSave(VISAKernelImpl *visaKernel, T &t) {
+  std::vector<RegSaveDebugInfo> entries;
+  collectCalleeSave(visaKernel, entries);
+  emitDataPhyRegSaveInfo(entries, t);
 }
 
 template <class T>
@@ -1334,6 +1363,17 @@ void emitDataCallFrameInfo(VISAKernelImpl *visaKernel, T &t) {
 // compilationUnits has 1 kernel and stack call functions
 // referenced by it. In case stack call functions dont
 // exist in input, it only has a kernel.
+static std::string
+getDebugVarName(VISAKernelImpl *kernel, G4_Declare *dcl,
+                const std::pair<const char *, unsigned int> &dclInfo) {
+  if (kernel->getOptions()->getOption(vISA_UseFriendlyNameInDbg)) {
+    return dcl->getName();
+  }
+  std::string varName(dclInfo.first);
+  varName += std::to_string(dclInfo.second);
+  return varName;
+}
+
 template <class T>
 void emitData(CISA_IR_Builder::KernelListTy &compilationUnits, T t) {
   const unsigned int magic = DEBUG_MAGIC_NUMBER;
@@ -1443,13 +1483,8 @@ void emitData(CISA_IR_Builder::KernelListTy &compilationUnits, T t) {
         continue;
       }
 
-      const std::pair<const char *, unsigned int> &dclInfo =
-          mapDclName.find(dcl)->second;
-      std::string varName(dclInfo.first);
-      varName += std::to_string(dclInfo.second);
-      if (curKernel->getOptions()->getOption(vISA_UseFriendlyNameInDbg)) {
-        varName = dcl->getName();
-      }
+      std::string varName =
+          getDebugVarName(curKernel, dcl, mapDclName.find(dcl)->second);
       emitDataName(varName.c_str(), t);
 
       // Insert live-interval information
@@ -1466,18 +1501,129 @@ void emitData(CISA_IR_Builder::KernelListTy &compilationUnits, T t) {
   }
 }
 
-void emitDebugInfoToMem(VISAKernelImpl *kernel,
-                        CISA_IR_Builder::KernelListTy &functions, void *&info,
-                        unsigned &size) {
-  std::vector<unsigned char> vec;
-  CISA_IR_Builder::KernelListTy compilationUnits;
+// Same walk as emitData, handing the records to the sink instead of
+// serializing them.
+static void emitDataToSink(CISA_IR_Builder::KernelListTy &compilationUnits,
+                           DebugInfoSink &sink) {
+  for (VISAKernelImpl *curKernel : compilationUnits) {
+    KernelDebugInfo *dbgInfo = curKernel->getKernel()->getKernelDebugInfo();
+
+    uint32_t reloc_offset = 0;
+    if (!curKernel->getIsKernel()) {
+      reloc_offset = dbgInfo->getRelocOffset();
+    }
+    sink.beginCompiledObject(curKernel->getName(), reloc_offset);
+
+    for (const auto &CisaOffset2Gen : dbgInfo->getMapCISAOffsetGenOffset()) {
+      sink.addCISAOffset(CisaOffset2Gen.CisaByteOffset,
+                         CisaOffset2Gen.GenOffset - reloc_offset);
+    }
+
+    for (const auto &CisaIndex2Gen : dbgInfo->getMapCISAIndexGenOffset()) {
+      sink.addCISAIndex(CisaIndex2Gen.CisaIndex,
+                        CisaIndex2Gen.GenOffset - reloc_offset);
+    }
+
+    std::map<G4_Declare *, std::pair<const char *, unsigned int>> mapDclName;
+    populateMapDclName(curKernel, mapDclName);
+
+    auto &varsMap = dbgInfo->getVarsMap();
+    for (unsigned int i = 0, e = (uint32_t)varsMap.size(); i < e; i++) {
+      G4_Declare *dcl = varsMap[i]->dcl;
+      auto dclIt = mapDclName.find(dcl);
+      if (dclIt == mapDclName.end()) {
+        continue;
+      }
+
+      std::string varName = getDebugVarName(curKernel, dcl, dclIt->second);
+      sink.beginVariable(varName.c_str());
+      sinkVarLiveIntervals(curKernel, dbgInfo->getLiveIntervalInfo(dcl, false),
+                           i, sink);
+    }
+
+    std::vector<SubroutineDebugInfo> subs;
+    collectSubroutines(curKernel->getKernel(), subs);
+    for (auto &sub : subs) {
+      sink.beginSubroutine(sub.name, sub.startVISAIndex, sub.endVISAIndex);
+      if (auto lv = dbgInfo->getLiveIntervalInfo(sub.retval, false)) {
+        sinkVarLiveIntervals(curKernel, lv, dbgInfo->getVarIndex(sub.retval),
+                             sink);
+      }
+    }
+
+    G4_Kernel *kernel = curKernel->getKernel();
+    sink.setFrameSize((uint16_t)dbgInfo->getFrameSize());
+
+    if (auto befpDcl = dbgInfo->getBEFP()) {
+      if (auto befpLIInfo = dbgInfo->getLiveIntervalInfo(befpDcl, false)) {
+        sink.beginFrameEntry(DebugInfoSink::FrameEntry::BEFP);
+        sinkVarLiveIntervals(curKernel, befpLIInfo,
+                             dbgInfo->getVarIndex(kernel->fg.framePtrDcl),
+                             sink);
+      }
+    }
+
+    if (auto callerfpdcl = dbgInfo->getCallerBEFP()) {
+      if (auto callerfpLIInfo =
+              dbgInfo->getLiveIntervalInfo(callerfpdcl, false)) {
+        sink.beginFrameEntry(DebugInfoSink::FrameEntry::CallerBEFP);
+        sink.addLiveInterval(getFrameDescriptorLiveInterval(
+            callerfpLIInfo, kernel->stackCall.offsets.BE_FP));
+      }
+    }
+
+    if (auto fretVar = dbgInfo->getFretVar()) {
+      if (auto fretVarLIInfo = dbgInfo->getLiveIntervalInfo(fretVar, false)) {
+        sink.beginFrameEntry(DebugInfoSink::FrameEntry::RetAddr);
+        sink.addLiveInterval(getFrameDescriptorLiveInterval(
+            fretVarLIInfo, kernel->stackCall.offsets.Ret_IP));
+      }
+    }
+
+    std::vector<RegSaveDebugInfo> calleeSave, callerSave;
+    collectCalleeSave(curKernel, calleeSave);
+    collectCallerSave(curKernel, callerSave);
+    for (auto *entries : {&calleeSave, &callerSave}) {
+      for (auto &entry : *entries) {
+        sink.beginRegSave(entries == &calleeSave, entry.genIPOffset);
+        for (auto &mapping : entry.mappings) {
+          sink.addRegSaveMapping(mapping);
+        }
+      }
+    }
+  }
+}
+
+static void
+getDebugInfoCompilationUnits(VISAKernelImpl *kernel,
+                             CISA_IR_Builder::KernelListTy &functions,
+                             CISA_IR_Builder::KernelListTy &compilationUnits) {
   compilationUnits.push_back(kernel);
   auto funcItEnd = functions.end();
   for (auto funcIt = functions.begin(); funcIt != funcItEnd; funcIt++) {
     if ((*funcIt)->getKernel()->getKernelDebugInfo()->getRelocOffset() != 0) {
+      // Include compilation unit only if
+      // it is referenced, ie reloc_offset
+      // for gen binary is non-zero.
       compilationUnits.push_back((*funcIt));
     }
   }
+}
+
+void emitDebugInfoToSink(VISAKernelImpl *kernel,
+                         CISA_IR_Builder::KernelListTy &functions,
+                         DebugInfoSink &sink) {
+  CISA_IR_Builder::KernelListTy compilationUnits;
+  getDebugInfoCompilationUnits(kernel, functions, compilationUnits);
+  emitDataToSink(compilationUnits, sink);
+}
+
+void emitDebugInfoToMem(VISAKernelImpl *kernel,
+                        CISA_IR_Builder::KernelListTy &functions, void *&info,
+                        unsigned &size) {
+  std::vector<unsigned char> vec;
+  CISA_IR_Builder::KernelListTy compilationUnits;
+  getDebugInfoCompilationUnits(kernel, functions, compilationUnits);
 
   emitData<std::vector<unsigned char> &>(compilationUnits, vec);
 
@@ -1526,16 +1672,7 @@ void emitDebugInfo(VISAKernelImpl *kernel,
                    CISA_IR_Builder::KernelListTy &functions,
                    std::string debugFileNameStr) {
   CISA_IR_Builder::KernelListTy compilationUnits;
-  compilationUnits.push_back(kernel);
-  auto funcItEnd = functions.end();
-  for (auto funcIt = functions.begin(); funcIt != funcItEnd; funcIt++) {
-    if ((*funcIt)->getKernel()->getKernelDebugInfo()->getRelocOffset() != 0) {
-      // Include compilation unit only if
-      // it is referenced, ie reloc_offset
-      // for gen binary is non-zero.
-      compilationUnits.push_back((*funcIt));
-    }
-  }
+  getDebugInfoCompilationUnits(kernel, functions, compilationUnits);
   VISA_DEBUG_VERBOSE({
     addCallFrameInfo(kernel);
 
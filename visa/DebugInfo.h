@@ -43,6 +43,9 @@ void emitDebugInfo(VISAKernelImpl *kernel,
 void emitDebugInfoToMem(VISAKernelImpl *kernel,
                         CISA_IR_Builder::KernelListTy &functions, void *&info,
                         unsigned &size);
+void emitDebugInfoToSink(VISAKernelImpl *kernel,
+                         CISA_IR_Builder::KernelListTy &functions,
+                         vISA::DebugInfoSink &sink);
 
 struct IDX_VDbgCisaByte2Gen {
   unsigned CisaByteOffset;
@@ -22,6 +22,7 @@ SPDX-License-Identifier: MIT
 #include "iga/IGALibrary/api/iga.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <fstream>
@@ -314,6 +315,8 @@ G4_INST *FlowGraph::createNewLabelInst(G4_Label *label) {
 void FlowGraph::removePredSuccEdges(G4_BB *pred, G4_BB *succ) {
   vISA_ASSERT(pred != NULL && succ != NULL, ERROR_INTERNAL_ARGUMENT);
 
+  markStaleForEdge(pred, succ, /*isInsertion*/ false);
+
   BB_LIST_ITER lt = pred->Succs.begin();
   for (; lt != pred->Succs.end(); ++lt) {
     if ((*lt) == succ) {
@@ -329,8 +332,6 @@ void FlowGraph::removePredSuccEdges(G4_BB *pred, G4_BB *succ) {
       break;
     }
   }
-
-  markStale();
 }
 
 G4_BB *FlowGraph::createNewBB(bool insertInFG) {
@@ -354,7 +355,8 @@ G4_BB *FlowGraph::createNewBBWithLabel(const char *LabelSuffix) {
   return newBB;
 }
 
-static int globalCount = 1;
+// shared by all kernels, which may be compiled concurrently
+static std::atomic<int> globalCount{1};
 
 int64_t FlowGraph::insertDummyUUIDMov() {
   // Here when -addKernelId is passed
@@ -372,8 +374,7 @@ int64_t FlowGraph::insertDummyUUIDMov() {
       uint32_t seed = (uint32_t)std::chrono::high_resolution_clock::now()
                           .time_since_epoch()
                           .count();
-      std::mt19937 mt_rand(seed * globalCount);
-      globalCount++;
+      std::mt19937 mt_rand(seed * globalCount++);
 
       G4_DstRegRegion *nullDst = builder->createNullDst(Type_UD);
       int64_t uuID = (int64_t)mt_rand();
@@ -632,8 +633,11 @@ void FlowGraph::constructFlowGraph(INST_LIST &instlist) {
     // done before RA ToDo: just hard-wire the scratch-surface offset register?
     builder->initScratchSurfaceOffset();
   }
+  // Options are shared by all functions being compiled, which may run
+  // concurrently, so only write it when it actually changes.
   if (builder->hasFusedEU() && !builder->getOption(vISA_KeepScalarJmp) &&
-      getKernel()->getInt32KernelAttr(Attributes::ATTR_Target) == VISA_CM) {
+      getKernel()->getInt32KernelAttr(Attributes::ATTR_Target) == VISA_CM &&
+      builder->getOption(vISA_EnableScalarJmp)) {
     getKernel()->getOptions()->setOptionInternally(vISA_EnableScalarJmp, false);
   }
 
@@ -2204,13 +2208,19 @@ void FlowGraph::reassignBlockIDs() {
   // that depends on BB id. Or the code will be incorrect once we reassign id.
   //
   unsigned i = 0;
+  bool changed = false;
   for (G4_BB *bb : BBs) {
+    changed |= bb->getId() != i;
     bb->setId(i);
     i++;
     vISA_ASSERT(i <= getNumBB(), ERROR_FLOWGRAPH);
   }
 
   numBBId = i;
+
+  // Dominator and loop info are indexed by BB id.
+  if (changed)
+    markStale();
 }
 
 // Find the BB that has the given label from the range [StartIter, EndIter).
@@ -3828,6 +3838,16 @@ void vISA::FlowGraph::markStale() {
   // should be marked as stale here.
 }
 
+void vISA::FlowGraph::markStaleForEdge(G4_BB *pred, G4_BB *succ,
+                                       bool isInsertion) {
+  if (isInsertion)
+    immDom.updateForEdgeInsertion(pred, succ);
+  else
+    immDom.updateForEdgeRemoval(pred, succ);
+  pDom.setStale();
+  loops.setStale();
+}
+
 //
 // Find back-edges in the flow graph.
 //
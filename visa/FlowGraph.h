@@ -439,7 +439,7 @@ public:
   void setBuilder(IR_Builder *pBuilder) { builder = pBuilder; }
 
   void addPredSuccEdges(G4_BB *pred, G4_BB *succ, bool tofront = true) {
-    markStale();
+    markStaleForEdge(pred, succ, /*isInsertion*/ true);
 
     if (tofront)
       pred->Succs.push_front(succ);
@@ -600,6 +600,9 @@ public:
   PostDom &getPostDominator() { return pDom; }
   LoopDetection &getLoops() { return loops; }
   void markStale();
+  // Like markStale(), but for the insertion/removal of the single edge
+  // pred->succ; analyses the edge provably does not affect are kept.
+  void markStaleForEdge(G4_BB *pred, G4_BB *succ, bool isInsertion);
 
 private:
   // Use normalized region descriptors for each source operand if possible.
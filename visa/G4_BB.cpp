@@ -257,9 +257,10 @@ void G4_BB::emitInstructionSourceLineMapping(std::ostream &output,
   // We record the previous instruction's source code locations so that they are
   // emitted only when there's a change.
   // Using global variables is ok here since this function is for shader dumps
-  // (i.e., debugging) only.
-  static const char *prevFilename = nullptr;
-  static int prevSrcLineNo = 0;
+  // (i.e., debugging) only. They are per thread as functions may be compiled
+  // concurrently.
+  static thread_local const char *prevFilename = nullptr;
+  static thread_local int prevSrcLineNo = 0;
 
   const char *curFilename = (*it)->getSrcFilename();
   int curSrcLineNo = (*it)->getLineNo();
@@ -23,7 +23,12 @@ llvm::json::Value toJSON(const PERF_STATS &p) {
     {"numGRFSpillFill", p.numGRFSpillFillWeighted},
     {"GRFSpillSize", p.spillMemUsed},
     {"numCycles", p.numCycles},
-    {"maxGRFPressure", p.maxGRFPressure}
+    {"maxGRFPressure", p.maxGRFPressure},
+    {"estCycle", p.estCycle},
+    {"estALUCycle", p.estALUCycle},
+    {"estSendCycle", p.estSendCycle},
+    {"estSyncCycle", p.estSyncCycle},
+    {"estBottleneck", (int)p.estBottleneck}
   };
 }
 
@@ -41,6 +46,9 @@ llvm::json::Value toJSON(const PERF_STATS_VERBOSE &p) {
       {"singlePipeAtOneDistNum", p.singlePipeAtOneDistNum},
       {"allAtOneDistNum", p.allAtOneDistNum},
       {"AfterWriteTokenDepCount", p.AfterWriteTokenDepCount},
+      {"domRebuildNum", p.domRebuildNum},
+      {"postDomRebuildNum", p.postDomRebuildNum},
+      {"loopRebuildNum", p.loopRebuildNum},
   };
   if (p.RAIterNum) {
     jsonObject.insert({"RAIterNum", p.RAIterNum});
@@ -23,6 +23,7 @@ SPDX-License-Identifier: MIT
 #include <iostream>
 #include <list>
 #include <queue>
+#include <unordered_set>
 
 using namespace vISA;
 
@@ -34,6 +35,10 @@ static const unsigned PRESSURE_REDUCTION_THRESHOLD = 110;
 static const unsigned PRESSURE_LATENCY_HIDING_THRESHOLD = 104;
 static const unsigned PRESSURE_HIGH_THRESHOLD = 128;
 static const unsigned PRESSURE_REDUCTION_THRESHOLD_SIMD32 = 120;
+// Max number of instructions examined at the top of a superblock successor.
+static const unsigned SUPERBLOCK_SCAN_WINDOW = 64;
+// Only instructions at least this slow are worth hoisting across blocks.
+static const unsigned SUPERBLOCK_MIN_HOIST_LATENCY = 16;
 
 namespace {
 
@@ -555,6 +560,270 @@ static unsigned getLatencyHidingThreshold(G4_Kernel &kernel, unsigned NumGrfs) {
   return unsigned(RPThreshold * (std::max(NumGrfs, 128u) - 48u) / 80u);
 }
 
+namespace {
+
+// Upward code motion across block boundaries within superblocks.
+//
+// A superblock is a chain of blocks B0, B1, ..., Bn in the same innermost
+// loop where each Bi+1 follows Bi in the layout, is a successor of Bi and has
+// Bi as its only predecessor. Bi may end with a conditional branch (a side
+// exit), but control can only enter the chain at B0. Long-latency
+// instructions at the top of Bi+1 whose operands are ready at the end of Bi,
+// and the instructions feeding them, are moved into Bi, so that the
+// per-block scheduler can overlap their latency with the rest of Bi.
+//
+// Moving above a side exit is speculative. It is only done for instructions
+// without side effects whose destination is dead on the exit path. Memory
+// loads are only speculated if they cannot fault (sampler and SLM).
+class SuperblockHoisting {
+  G4_Kernel &kernel;
+  RegisterPressure &rp;
+  const LatencyTable &LT;
+
+  // Dump every hoisted instruction (the dump bit of -presched-ctrl).
+  bool Dump;
+
+  // Register pressure in GRFs that hoisting must not exceed.
+  unsigned PressureLimit;
+
+  struct ScanState {
+    std::unordered_set<const G4_Declare *> Defs;
+    std::unordered_set<const G4_Declare *> Uses;
+    bool SeenMemAccess = false;
+  };
+
+public:
+  SuperblockHoisting(G4_Kernel &kernel, RegisterPressure &rp,
+                     const LatencyTable &LT, bool Dump, unsigned PressureLimit)
+      : kernel(kernel), rp(rp), LT(LT), Dump(Dump),
+        PressureLimit(PressureLimit) {}
+
+  bool run();
+
+private:
+  bool isSuperblockEdge(G4_BB *Pred, G4_BB *Succ);
+  bool canHoist(G4_INST *Inst, G4_BB *Pred, G4_BB *Succ,
+                const ScanState &State) const;
+  void scan(G4_BB *Pred, G4_BB *Succ,
+            const std::unordered_set<G4_INST *> *Wanted,
+            std::vector<INST_LIST_ITER> &Movable) const;
+  unsigned hoist(G4_BB *Pred, G4_BB *Succ);
+};
+
+// Return the root declare of a direct operand of a GRF variable or nullptr.
+static G4_Declare *getGRFVarRootDcl(G4_Operand *Opnd) {
+  if (!Opnd || !Opnd->isRegRegion() || Opnd->isIndirect() ||
+      !Opnd->getBase()->isRegVar() || !Opnd->getTopDcl())
+    return nullptr;
+  G4_Declare *Dcl = Opnd->getTopDcl()->getRootDeclare();
+  if (!(Dcl->getRegFile() & (G4_GRF | G4_INPUT)))
+    return nullptr;
+  return Dcl;
+}
+
+static unsigned getNumGRFs(G4_Kernel &kernel, const G4_Declare *Dcl) {
+  unsigned GRFSize = kernel.numEltPerGRF<Type_UB>();
+  return (Dcl->getByteSize() + GRFSize - 1) / GRFSize;
+}
+
+bool SuperblockHoisting::isSuperblockEdge(G4_BB *Pred, G4_BB *Succ) {
+  if (Succ->Preds.size() != 1 || Succ->Preds.front() != Pred ||
+      Succ == Pred ||
+      std::find(Pred->Succs.begin(), Pred->Succs.end(), Succ) ==
+          Pred->Succs.end())
+    return false;
+
+  // Only conditional forward branches may leave the chain.
+  if (!Pred->empty() && Pred->back()->isFlowControl()) {
+    G4_INST *Br = Pred->back();
+    if ((Br->opcode() != G4_jmpi && Br->opcode() != G4_goto) ||
+        !Br->getPredicate() || Br->asCFInst()->isBackward())
+      return false;
+  }
+
+  auto &Loops = kernel.fg.getLoops();
+  return Loops.getInnerMostLoop(Pred) == Loops.getInnerMostLoop(Succ);
+}
+
+bool SuperblockHoisting::canHoist(G4_INST *Inst, G4_BB *Pred, G4_BB *Succ,
+                                  const ScanState &State) const {
+  if (Inst->isLabel() || Inst->isFlowControl() || Inst->isLifeTimeEnd() ||
+      (Inst->isIntrinsic() && !Inst->isPseudoKill()))
+    return false;
+  if (Inst->getPredicate() || Inst->getCondMod() || Inst->useAcc() ||
+      Inst->isEOT())
+    return false;
+
+  bool HasSideExit = !Pred->empty() && Pred->back()->isFlowControl();
+  if (Inst->isSend()) {
+    G4_SendDesc *MsgDesc = Inst->getMsgDesc();
+    if (!MsgDesc->isRead() || MsgDesc->isAtomic() || MsgDesc->isFence() ||
+        MsgDesc->isBarrier() || State.SeenMemAccess)
+      return false;
+    if (HasSideExit && !MsgDesc->isSampler() && !MsgDesc->isSLM())
+      return false;
+  }
+
+  G4_Declare *DstDcl = getGRFVarRootDcl(Inst->getDst());
+  if (!DstDcl || !(DstDcl->getRegFile() & G4_GRF) ||
+      DstDcl->getRegVar()->isPhyRegAssigned())
+    return false;
+  if (State.Defs.count(DstDcl) || State.Uses.count(DstDcl))
+    return false;
+
+  for (int i = 0, NumSrc = Inst->getNumSrc(); i < NumSrc; ++i) {
+    G4_Operand *Src = Inst->getSrc(i);
+    if (!Src || Src->isImm() || Src->isLabel())
+      continue;
+    G4_Declare *SrcDcl = getGRFVarRootDcl(Src);
+    if (!SrcDcl || State.Defs.count(SrcDcl))
+      return false;
+  }
+
+  // The destination must be dead on every side exit.
+  for (G4_BB *Exit : Pred->Succs) {
+    if (Exit != Succ &&
+        rp.liveness->isLiveAtEntry(Exit, DstDcl->getRegVar()->getId()))
+      return false;
+  }
+  return true;
+}
+
+// Collect the instructions at the top of Succ that can be moved into Pred.
+// If Wanted is given, only instructions in it are moved; all others stay in
+// Succ and constrain the instructions after them.
+void SuperblockHoisting::scan(
+    G4_BB *Pred, G4_BB *Succ, const std::unordered_set<G4_INST *> *Wanted,
+    std::vector<INST_LIST_ITER> &Movable) const {
+  ScanState State;
+  unsigned Scanned = 0;
+  for (auto It = Succ->begin(), End = Succ->end();
+       It != End && Scanned < SUPERBLOCK_SCAN_WINDOW; ++It) {
+    G4_INST *Inst = *It;
+    if (Inst->isLabel())
+      continue;
+    if (Inst->isFlowControl())
+      break;
+    ++Scanned;
+
+    if ((!Wanted || Wanted->count(Inst)) &&
+        canHoist(Inst, Pred, Succ, State)) {
+      Movable.push_back(It);
+      continue;
+    }
+
+    if (G4_Declare *Dcl = getGRFVarRootDcl(Inst->getDst()))
+      State.Defs.insert(Dcl);
+    for (int i = 0, NumSrc = Inst->getNumSrc(); i < NumSrc; ++i) {
+      if (G4_Declare *Dcl = getGRFVarRootDcl(Inst->getSrc(i)))
+        State.Uses.insert(Dcl);
+    }
+    // Operands that are not tracked above (flags, address registers,
+    // indirect accesses) block everything that follows.
+    if (Inst->getCondMod() || Inst->useAcc() ||
+        (Inst->getDst() && !Inst->getDst()->isNullReg() &&
+         !getGRFVarRootDcl(Inst->getDst())))
+      break;
+    if (Inst->isSend())
+      State.SeenMemAccess = true;
+  }
+}
+
+unsigned SuperblockHoisting::hoist(G4_BB *Pred, G4_BB *Succ) {
+  std::vector<INST_LIST_ITER> Candidates;
+  scan(Pred, Succ, nullptr, Candidates);
+  if (Candidates.empty())
+    return 0;
+
+  // Keep the long-latency candidates and, walking backwards, the candidates
+  // that define a value read by (or killed for) a kept instruction.
+  std::unordered_set<G4_INST *> Wanted;
+  std::unordered_set<const G4_Declare *> NeededDefs;
+  for (auto RI = Candidates.rbegin(); RI != Candidates.rend(); ++RI) {
+    G4_INST *Inst = **RI;
+    const G4_Declare *DstDcl = getGRFVarRootDcl(Inst->getDst());
+    if (LT.getLatency(Inst) < SUPERBLOCK_MIN_HOIST_LATENCY &&
+        !NeededDefs.count(DstDcl))
+      continue;
+    Wanted.insert(Inst);
+    if (!Inst->isPseudoKill())
+      NeededDefs.insert(DstDcl);
+    for (int i = 0, NumSrc = Inst->getNumSrc(); i < NumSrc; ++i) {
+      if (G4_Declare *Dcl = getGRFVarRootDcl(Inst->getSrc(i)))
+        NeededDefs.insert(Dcl);
+    }
+  }
+  if (Wanted.empty())
+    return 0;
+
+  // Instructions that are not wanted stay behind, which may block some of
+  // the wanted ones; rescan with that in mind.
+  std::vector<INST_LIST_ITER> ToMove;
+  scan(Pred, Succ, &Wanted, ToMove);
+
+  INST_LIST_ITER InsertPos = Pred->end();
+  if (!Pred->empty() && Pred->back()->isFlowControl())
+    InsertPos = std::prev(Pred->end());
+  unsigned Pressure = 0;
+  for (auto Inst : *Pred) {
+    if (!Inst->isPseudoKill())
+      Pressure = rp.getPressure(Inst);
+  }
+
+  unsigned NumMoved = 0;
+  for (INST_LIST_ITER It : ToMove) {
+    G4_INST *Inst = *It;
+    unsigned Size = Inst->isPseudoKill()
+                        ? 0
+                        : getNumGRFs(kernel, getGRFVarRootDcl(Inst->getDst()));
+    if (Pressure + Size > PressureLimit)
+      break;
+    Pressure += Size;
+    if (Dump) {
+      std::cerr << "Hoist from BB" << Succ->getId() << " to BB"
+                << Pred->getId() << ": ";
+      Inst->dump();
+    }
+    Pred->splice(InsertPos, Succ, It);
+    ++NumMoved;
+  }
+  return NumMoved;
+}
+
+bool SuperblockHoisting::run() {
+  std::vector<G4_BB *> Layout(kernel.fg.begin(), kernel.fg.end());
+  unsigned NumMoved = 0;
+  // Go bottom-up so that instructions can travel more than one block up the
+  // chain.
+  for (size_t i = Layout.size(); i > 1; --i) {
+    G4_BB *Pred = Layout[i - 2];
+    G4_BB *Succ = Layout[i - 1];
+    if (isSuperblockEdge(Pred, Succ))
+      NumMoved += hoist(Pred, Succ);
+  }
+
+  if (NumMoved)
+    kernel.fg.resetLocalDataFlowData();
+  return NumMoved != 0;
+}
+
+} // namespace
+
+// Form superblocks and hoist instructions across their block boundaries
+// before scheduling each block. Uses a private pressure estimate as the
+// liveness it relies on is invalidated by the code motion.
+static bool hoistInSuperblocks(G4_Kernel &kernel, const LatencyTable &LT,
+                               SchedConfig config) {
+  if (!kernel.getOption(vISA_preRA_ScheduleSuperblock))
+    return false;
+
+  RegisterPressure rp(kernel, nullptr);
+  unsigned NumGrfs = kernel.getNumRegTotal();
+  SuperblockHoisting SH(kernel, rp, LT, config.Dump,
+                        getLatencyHidingThreshold(kernel, NumGrfs));
+  return SH.run();
+}
+
 preRA_Scheduler::preRA_Scheduler(G4_Kernel &k)
     : kernel(k) {}
 
@@ -572,12 +841,12 @@ bool preRA_Scheduler::run(unsigned &KernelPressure) {
 
   auto LT = LatencyTable::createLatencyTable(*kernel.fg.builder);
   SchedConfig config(SchedCtrl);
+  bool Changed = hoistInSuperblocks(kernel, *LT, config);
   RegisterPressure rp(kernel, nullptr);
   // skip extreme test cases that scheduling does not good
   // if (kernel.fg.getNumBB() >= 10000 && rp.rpe->getMaxRP() >= 800)
   //   return false;
 
-  bool Changed = false;
   for (auto bb : kernel.fg) {
     if (bb->size() < SMALL_BLOCK_SIZE || bb->size() > LARGE_BLOCK_SIZE) {
       SCHED_DUMP(std::cerr << "Skip block with instructions " << bb->size()
@@ -634,14 +903,13 @@ bool preRA_RegSharing::run(unsigned &KernelPressure) {
       return false;
   }
 
-  bool Changed = false;
-
   unsigned SchedCtrl = kernel.getuInt32Option(vISA_preRA_ScheduleCtrl);
   SchedConfig config(SchedCtrl);
+  auto LT = LatencyTable::createLatencyTable(*kernel.fg.builder);
+  bool Changed = hoistInSuperblocks(kernel, *LT, config);
   RegisterPressure rp(kernel, nullptr);
   KernelPressure = rp.getMaxRP();
   unsigned RPReductionThreshold = getRPReductionThreshold(kernel);
-  auto LT = LatencyTable::createLatencyTable(*kernel.fg.builder);
 
   // Schedule for reg pressure reduction if needed
   for (auto bb : kernel.fg) {
@@ -12,6 +12,8 @@ SPDX-License-Identifier: MIT
 #include "G4_BB.hpp"
 #include "G4_Kernel.hpp"
 
+#include <algorithm>
+
 using namespace vISA;
 
 G4_BB *ImmDominator::InterSect(G4_BB *bb, int i, int k) {
@@ -183,7 +185,7 @@ bool ImmDominator::dominates(G4_BB *bb1, G4_BB *bb2) {
     return (bb1 == Root);
 
   // Track back from bb2 if neither of them is the root block.
-  auto IDoms = kernel.fg.getImmDominator().getIDoms();
+  const auto &IDoms = kernel.fg.getImmDominator().getIDoms();
   G4_BB *idom = bb2;
   do {
     idom = IDoms[idom->getId()];
@@ -195,6 +197,67 @@ bool ImmDominator::dominates(G4_BB *bb1, G4_BB *bb2) {
   return false;
 }
 
+bool ImmDominator::isReachable(const G4_BB *bb) const {
+  return bb == entryBB || iDoms[bb->getId()] != nullptr;
+}
+
+// Same as dominates() but works on the current (valid) tree only, and
+// tolerates unreachable blocks.
+bool ImmDominator::dominatesNoRecompute(const G4_BB *bb1,
+                                        const G4_BB *bb2) const {
+  for (const G4_BB *bb = bb2; bb; bb = iDoms[bb->getId()]) {
+    if (bb == bb1)
+      return true;
+    if (bb == entryBB)
+      break;
+  }
+  return false;
+}
+
+// Adding pred->succ leaves the dominator tree unchanged if pred is
+// unreachable, or if idom(succ) dominates pred: any new path through the edge
+// then still visits every strict dominator of succ before reaching it.
+void ImmDominator::updateForEdgeInsertion(G4_BB *pred, G4_BB *succ) {
+  if (isStale())
+    return;
+
+  auto numBBs = iDoms.size();
+  if (pred->getId() >= numBBs || succ->getId() >= numBBs) {
+    setStale();
+    return;
+  }
+
+  if (!isReachable(pred) || succ == entryBB)
+    return;
+  if (isReachable(succ) &&
+      dominatesNoRecompute(iDoms[succ->getId()], pred))
+    return;
+
+  setStale();
+}
+
+// Removing pred->succ leaves the dominator tree unchanged if pred is
+// unreachable, if the edge is a back edge (succ dominates pred, so every path
+// using it can be shortened into one that does not), or if it is a duplicate
+// of another pred->succ edge.
+void ImmDominator::updateForEdgeRemoval(G4_BB *pred, G4_BB *succ) {
+  if (isStale())
+    return;
+
+  auto numBBs = iDoms.size();
+  if (pred->getId() >= numBBs || succ->getId() >= numBBs) {
+    setStale();
+    return;
+  }
+
+  if (!isReachable(pred) || dominatesNoRecompute(succ, pred))
+    return;
+  if (std::count(pred->Succs.begin(), pred->Succs.end(), succ) > 1)
+    return;
+
+  setStale();
+}
+
 void ImmDominator::dump(std::ostream &os) {
   if (isStale())
     os << "Imm dominator data is stale.\n";
@@ -232,6 +295,7 @@ void Analysis::recomputeIfStale() {
   reset();
   run();
   inProgress = false;
+  numRuns++;
 }
 
 PostDom::PostDom(G4_Kernel &k) : kernel(k) {}
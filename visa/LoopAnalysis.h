@@ -29,6 +29,9 @@ public:
 
   void recomputeIfStale();
 
+  // Number of times the analysis has been (re)computed.
+  unsigned getNumRuns() const { return numRuns; }
+
   virtual void reset() = 0;
   virtual void run() = 0;
   virtual void dump(std::ostream &os = std::cerr) = 0;
@@ -37,6 +40,7 @@ private:
   bool stale = true;
   // flag to avoid re-triggering of analysis run when run is already in progress
   bool inProgress = false;
+  unsigned numRuns = 0;
 };
 
 class ImmDominator : public Analysis {
@@ -49,6 +53,12 @@ public:
   void dumpImmDom(std::ostream &os = std::cerr);
   const std::vector<G4_BB *> &getIDoms();
 
+  // Keep the dominator tree valid across the insertion/removal of the edge
+  // pred->succ if the edge provably cannot change it, otherwise mark the
+  // analysis stale. Must be called before the edge is actually changed.
+  void updateForEdgeInsertion(G4_BB *pred, G4_BB *succ);
+  void updateForEdgeRemoval(G4_BB *pred, G4_BB *succ);
+
 private:
   G4_Kernel &kernel;
   G4_BB *entryBB = nullptr;
@@ -62,6 +72,8 @@ private:
 
   void runIDOM();
   G4_BB *InterSect(G4_BB *bb, int i, int k);
+  bool isReachable(const G4_BB *bb) const;
+  bool dominatesNoRecompute(const G4_BB *bb1, const G4_BB *bb2) const;
 
   void reset() override;
   void run() override;
@@ -16,6 +16,7 @@ SPDX-License-Identifier: MIT
 #include "DebugInfo.h"
 #include "FlowGraph.h"
 #include "Passes/AccSubstitution.hpp"
+#include "Passes/BlockLayout.hpp"
 #include "PointsToAnalysis.h"
 #include "Passes/InstCombine.hpp"
 #include "Passes/LVN.hpp"
@@ -137,6 +138,20 @@ void Optimizer::insertFallThroughJump() {
   }
 }
 
+//
+// Profile-guided block placement. Does nothing unless a block profile is
+// given with -blockProfile.
+//
+void Optimizer::blockLayout() {
+  const char *profileFile =
+      builder.getOptions()->getOptionCstr(vISA_BlockProfile);
+  if (!profileFile)
+    return;
+
+  doProfileGuidedBlockLayout(
+      fg, profileFile, builder.getuint32Option(vISA_BlockProfileColdThreshold));
+}
+
 void Optimizer::preRA_Schedule() {
   bool Changed = false;
   unsigned KernelPressure = 0;
@@ -687,6 +702,7 @@ void Optimizer::initOptimizations() {
   OPT_INITIALIZE_PASS(postRA_HWWorkaround, vISA_EnableAlways, TimerID::MISC_OPTS);
   OPT_INITIALIZE_PASS(removeRedundMov, vISA_removeRedundMov, TimerID::MISC_OPTS);
   OPT_INITIALIZE_PASS(removeEmptyBlocks, vISA_EnableAlways, TimerID::MISC_OPTS);
+  OPT_INITIALIZE_PASS(blockLayout, vISA_EnableAlways, TimerID::MISC_OPTS);
   OPT_INITIALIZE_PASS(insertFallThroughJump, vISA_EnableAlways, TimerID::MISC_OPTS);
   OPT_INITIALIZE_PASS(reassignBlockIDs, vISA_EnableAlways, TimerID::MISC_OPTS);
   OPT_INITIALIZE_PASS(evalAddrExp, vISA_EnableAlways, TimerID::MISC_OPTS);
@@ -958,6 +974,9 @@ int Optimizer::optimization() {
   // HW workaround after RA
   runPass(PI_postRA_HWWorkaround);
 
+  // move blocks that a profile marks as cold out of the hot path
+  runPass(PI_blockLayout);
+
   //
   // if a fall-through BB does not immediately follow its predecessor
   // in the code layout, then insert a jump-to-fall-through in the predecessor
@@ -1056,6 +1075,11 @@ int Optimizer::optimization() {
 
   runPass(PI_staticProfiling);
 
+  auto &statsVerbose = builder.getJitInfo()->statsVerbose;
+  statsVerbose.domRebuildNum = kernel.fg.getImmDominator().getNumRuns();
+  statsVerbose.postDomRebuildNum = kernel.fg.getPostDominator().getNumRuns();
+  statsVerbose.loopRebuildNum = kernel.fg.getLoops().getNumRuns();
+
   if (EarlyExited) {
     return VISA_EARLY_EXIT;
   }
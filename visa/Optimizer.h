@@ -140,6 +140,7 @@ class Optimizer {
   void removeRedundMov() { fg.removeRedundMov(); }
   void removeEmptyBlocks() { fg.removeEmptyBlocks(); }
   void reassignBlockIDs() { fg.reassignBlockIDs(); }
+  void blockLayout();
   void evalAddrExp() { kernel.evalAddrExp(); }
 
   void ACCSchedule() {
@@ -343,6 +344,7 @@ public:
     PI_removeLifetimeOps, // always
     PI_removeRedundMov,       // always
     PI_removeEmptyBlocks,     // always
+    PI_blockLayout,           // always
     PI_insertFallThroughJump, // always
     PI_reassignBlockIDs,      // always
     PI_evalAddrExp,           // always
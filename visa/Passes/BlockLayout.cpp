@@ -0,0 +1,245 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#include "BlockLayout.hpp"
+#include "../BuildIR.h"
+#include "../FlowGraph.h"
+#include "../G4_IR.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace vISA;
+
+namespace {
+
+using BlockCounts = std::unordered_map<std::string, uint64_t>;
+
+// Read the entries of the profile that apply to the given kernel. Malformed
+// lines are ignored so that a stale or partial profile never breaks the build.
+BlockCounts readBlockCounts(const char *profileFile, const char *kernelName) {
+  BlockCounts counts;
+  std::ifstream ifs(profileFile);
+  if (!ifs) {
+    VISA_DEBUG(std::cerr << "cannot open block profile " << profileFile
+                         << "\n");
+    return counts;
+  }
+
+  std::string line;
+  while (std::getline(ifs, line)) {
+    auto commentPos = line.find('#');
+    if (commentPos != std::string::npos)
+      line.resize(commentPos);
+
+    std::istringstream iss(line);
+    std::string kernel, label;
+    uint64_t count = 0;
+    if (!(iss >> kernel >> label >> count))
+      continue;
+    if (kernel != "*" && (!kernelName || kernel != kernelName))
+      continue;
+    counts[label] = count;
+  }
+  return counts;
+}
+
+class BlockLayout {
+  FlowGraph &fg;
+  IR_Builder &builder;
+  const BlockCounts &counts;
+  const unsigned coldThreshold;
+
+  bool isCold(G4_BB *bb) const {
+    G4_Label *label = bb->getLabel();
+    if (!label)
+      return false;
+    auto it = counts.find(label->getLabel());
+    return it != counts.end() && it->second <= coldThreshold;
+  }
+
+  G4_Label *getOrCreateLabel(G4_BB *bb) {
+    if (G4_Label *label = bb->getLabel())
+      return label;
+    G4_Label *label = builder.createLocalBlockLabel("COLD_LAYOUT");
+    bb->push_front(fg.createNewLabelInst(label));
+    return label;
+  }
+
+  bool hasMovableControlFlow();
+  bool moveToEnd(BB_LIST_ITER first, BB_LIST_ITER last);
+  void updateBranchDirections();
+
+public:
+  BlockLayout(FlowGraph &fg, const BlockCounts &counts, unsigned coldThreshold)
+      : fg(fg), builder(*fg.builder), counts(counts),
+        coldThreshold(coldThreshold) {}
+
+  bool run();
+};
+
+// Blocks can only be reordered freely if every branch is a scalar jmpi to a
+// label. SIMD CF (goto/join, if/else/endif, while) and calls rely on the
+// physical order of the blocks, so kernels using them are left untouched.
+bool BlockLayout::hasMovableControlFlow() {
+  if (fg.getNumFuncs() != 0 || fg.getHasStackCalls() ||
+      fg.getIsStackCallFunc())
+    return false;
+
+  for (G4_BB *bb : fg) {
+    for (G4_INST *inst : *bb) {
+      if (!inst->isFlowControl())
+        continue;
+      if (inst->opcode() != G4_jmpi || !inst->getSrc(0)->isLabel())
+        return false;
+    }
+  }
+  return true;
+}
+
+// Move the run of cold blocks [first, last) to the end of the kernel. The
+// block in front of the run and the last block of the run get explicit jumps
+// where they used to fall through. If the block in front of the run ends with
+// a conditional jmpi over the run, the branch is inverted instead, so that the
+// hot successor becomes the fall-through. Returns false if the run cannot be
+// moved without adding new blocks.
+bool BlockLayout::moveToEnd(BB_LIST_ITER first, BB_LIST_ITER last) {
+  G4_BB *pred = *std::prev(first);
+  G4_BB *head = *first;
+  G4_BB *tail = *std::prev(last);
+  G4_BB *next = *last;
+
+  G4_INST *branchToInvert = nullptr;
+  bool needEntryJmp = false;
+  if (pred->fallThroughBB() == head) {
+    G4_INST *predLast = pred->empty() ? nullptr : pred->back();
+    if (predLast && predLast->opcode() == G4_jmpi) {
+      G4_Predicate *pr = predLast->getPredicate();
+      if (!pr || pr->getControl() != PRED_DEFAULT || !next->getLabel() ||
+          predLast->getSrc(0)->asLabel() != next->getLabel())
+        return false;
+      branchToInvert = predLast;
+    } else {
+      needEntryJmp = true;
+    }
+  }
+
+  bool needExitJmp = false;
+  if (tail->fallThroughBB() == next) {
+    if (!tail->empty() && tail->back()->opcode() == G4_jmpi)
+      return false;
+    needExitJmp = true;
+  }
+
+  if (branchToInvert) {
+    G4_Predicate *pr = branchToInvert->getPredicate();
+    pr->setState(pr->getState() == PredState_Plus ? PredState_Minus
+                                                  : PredState_Plus);
+    branchToInvert->setSrc(getOrCreateLabel(head), 0);
+    // The fall-through successor is expected to be the first one.
+    pred->Succs.remove(next);
+    pred->Succs.push_front(next);
+  } else if (needEntryJmp) {
+    pred->push_back(builder.createJmp(nullptr, getOrCreateLabel(head),
+                                      InstOpt_NoOpt, false));
+  }
+
+  if (needExitJmp) {
+    tail->push_back(builder.createJmp(nullptr, getOrCreateLabel(next),
+                                      InstOpt_NoOpt, false));
+  }
+
+  fg.getBBList().splice(fg.end(), fg.getBBList(), first, last);
+  return true;
+}
+
+// Forward/backward is recorded on each jmpi when the CFG is built; refresh it
+// for the new layout.
+void BlockLayout::updateBranchDirections() {
+  std::unordered_map<G4_Label *, unsigned> labelToId;
+  for (G4_BB *bb : fg) {
+    if (G4_Label *label = bb->getLabel())
+      labelToId[label] = bb->getId();
+  }
+
+  for (G4_BB *bb : fg) {
+    if (bb->empty() || bb->back()->opcode() != G4_jmpi)
+      continue;
+    G4_InstCF *jmp = bb->back()->asCFInst();
+    auto it = labelToId.find(jmp->getSrc(0)->asLabel());
+    if (it != labelToId.end())
+      jmp->setBackward(it->second <= bb->getId());
+  }
+}
+
+bool BlockLayout::run() {
+  if (!hasMovableControlFlow())
+    return false;
+
+  // A kernel that was never entered in the profiling run says nothing about
+  // which of its paths are hot.
+  if (isCold(fg.getEntryBB()))
+    return false;
+
+  // Collect the maximal runs of cold blocks first. Splicing a run to the end
+  // keeps the list iterators of the remaining runs valid. Runs already at the
+  // end of the kernel are left where they are.
+  std::vector<std::pair<BB_LIST_ITER, BB_LIST_ITER>> coldRuns;
+  for (auto it = std::next(fg.begin()), end = fg.end(); it != end;) {
+    if (!isCold(*it)) {
+      ++it;
+      continue;
+    }
+    auto runEnd = std::next(it);
+    while (runEnd != end && isCold(*runEnd))
+      ++runEnd;
+    if (runEnd != end)
+      coldRuns.emplace_back(it, runEnd);
+    it = runEnd;
+  }
+
+  bool changed = false;
+  for (auto &run : coldRuns) {
+    bool moved = moveToEnd(run.first, run.second);
+    VISA_DEBUG({
+      std::cerr << (moved ? "moved" : "cannot move") << " cold blocks BB"
+                << (*run.first)->getId() << " .. BB"
+                << (*std::prev(run.second))->getId() << "\n";
+    });
+    changed |= moved;
+  }
+
+  if (changed) {
+    fg.setPhysicalPredSucc();
+    fg.reassignBlockIDs();
+    updateBranchDirections();
+    // No edge changed, but dominator and loop info built before (e.g. by RA)
+    // are indexed by the old block ids.
+    fg.markStale();
+  }
+  return changed;
+}
+
+} // namespace
+
+namespace vISA {
+bool doProfileGuidedBlockLayout(FlowGraph &fg, const char *profileFile,
+                                unsigned coldThreshold) {
+  BlockCounts counts =
+      readBlockCounts(profileFile, fg.getKernel()->getName());
+  if (counts.empty())
+    return false;
+
+  BlockLayout layout(fg, counts, coldThreshold);
+  return layout.run();
+}
+} // namespace vISA
@@ -0,0 +1,24 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#ifndef VISA_PASSES_BLOCKLAYOUT_HPP
+#define VISA_PASSES_BLOCKLAYOUT_HPP
+
+namespace vISA {
+class FlowGraph;
+
+// Profile-guided block placement. profileFile holds per-block execution
+// counts, one "<kernel> <label> <count>" entry per line ('*' matches any
+// kernel, '#' starts a comment). Runs of blocks whose count is at most
+// coldThreshold are moved to the end of the kernel so that the hot path
+// becomes fall-through. Returns true if the layout was changed.
+bool doProfileGuidedBlockLayout(FlowGraph &fg, const char *profileFile,
+                                unsigned coldThreshold);
+} // namespace vISA
+
+#endif
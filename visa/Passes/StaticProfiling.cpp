@@ -7,7 +7,9 @@ SPDX-License-Identifier: MIT
 ============================= end_copyright_notice ===========================*/
 
 #include "StaticProfiling.hpp"
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 using namespace vISA;
 
@@ -21,3 +23,110 @@ void StaticProfiling::ALUInstructionProfile(G4_INST *inst) {
 
   jitInfo->statsVerbose.numALUInst++;
 }
+
+void StaticProfiling::throughputProfile(G4_BB *bb, const LatencyTable &LT,
+                                        uint64_t &aluCycle,
+                                        uint64_t &sendCycle,
+                                        uint64_t &syncCycle) {
+  // Tokens set in predecessors are assumed to be free at block entry.
+  // -SWSBTokenNum may raise the token count above the default.
+  const unsigned numTokens = kernel.getNumSWSBTokens();
+  std::vector<uint64_t> readReady(numTokens, 0);
+  std::vector<uint64_t> writeReady(numTokens, 0);
+  // Completion cycle of the ALU instructions issued so far, in order, for
+  // resolving distance dependences.
+  std::vector<uint64_t> aluDone;
+
+  uint64_t cycle = 0;
+  for (auto inst : *bb) {
+    if (inst->isLabel() || inst->isPseudoKill() || inst->isIntrinsic())
+      continue;
+
+    uint64_t distReady = cycle;
+    unsigned dist = inst->getDistance();
+    if (dist && dist <= aluDone.size())
+      distReady = std::max(distReady, aluDone[aluDone.size() - dist]);
+
+    uint64_t tokenReady = cycle;
+    switch (inst->getTokenType()) {
+    case G4_INST::AFTER_READ:
+      tokenReady = std::max(tokenReady, readReady[inst->getToken()]);
+      break;
+    case G4_INST::AFTER_WRITE:
+      tokenReady = std::max(tokenReady, writeReady[inst->getToken()]);
+      break;
+    default:
+      break;
+    }
+    if (inst->opcode() == G4_sync_allrd || inst->opcode() == G4_sync_allwr) {
+      const std::vector<uint64_t> &ready =
+          inst->opcode() == G4_sync_allrd ? readReady : writeReady;
+      // An immediate mask only covers the first 32 tokens, without one the
+      // sync waits for all of them.
+      G4_Operand *src0 = inst->getSrc(0);
+      bool hasMask = src0 && src0->isImm();
+      unsigned mask = hasMask ? (unsigned)src0->asImm()->getInt() : ~0u;
+      for (unsigned i = 0; i < numTokens; ++i) {
+        if (!hasMask || (i < 32 && (mask & (1u << i))))
+          tokenReady = std::max(tokenReady, ready[i]);
+      }
+    }
+
+    // A stall is charged to the dependence that resolves last.
+    uint64_t issue = std::max(distReady, tokenReady);
+    if (tokenReady > distReady)
+      syncCycle += issue - cycle;
+    else
+      aluCycle += issue - cycle;
+
+    unsigned occupancy = LT.getOccupancy(inst);
+    cycle = issue + occupancy;
+    if (inst->isSend() || inst->isDpas()) {
+      sendCycle += occupancy;
+      if (inst->getTokenType() == G4_INST::SB_SET) {
+        unsigned token = inst->getToken();
+        readReady[token] = cycle;
+        writeReady[token] = issue + LT.getLatency(inst);
+      }
+    } else if (inst->isSWSBSync()) {
+      syncCycle += occupancy;
+    } else {
+      aluCycle += occupancy;
+      aluDone.push_back(issue + LT.getLatency(inst));
+    }
+  }
+}
+
+void StaticProfiling::kernelThroughputProfile() {
+  if (!builder.hasSWSB())
+    return;
+
+  auto LT = LatencyTable::createLatencyTable(builder);
+  uint64_t alu = 0, send = 0, sync = 0;
+  for (auto bb : kernel.fg) {
+    uint64_t bbALU = 0, bbSend = 0, bbSync = 0;
+    throughputProfile(bb, *LT, bbALU, bbSend, bbSync);
+    // Expect that a loop runs 16 iterations.
+    unsigned nestingFactor = bb->getNestLevel() * 4;
+    alu += bbALU << nestingFactor;
+    send += bbSend << nestingFactor;
+    sync += bbSync << nestingFactor;
+  }
+
+  auto clamp = [](uint64_t v) {
+    return (uint32_t)std::min<uint64_t>(v, UINT32_MAX);
+  };
+  PERF_STATS &stats = builder.getJitInfo()->stats;
+  stats.estALUCycle = clamp(alu);
+  stats.estSendCycle = clamp(send);
+  stats.estSyncCycle = clamp(sync);
+  stats.estCycle = clamp(alu + send + sync);
+  if (alu + send + sync == 0)
+    stats.estBottleneck = PERF_BOTTLENECK::NONE;
+  else if (alu >= send && alu >= sync)
+    stats.estBottleneck = PERF_BOTTLENECK::ALU;
+  else if (send >= sync)
+    stats.estBottleneck = PERF_BOTTLENECK::SEND;
+  else
+    stats.estBottleneck = PERF_BOTTLENECK::SYNC;
+}
@@ -12,6 +12,7 @@ SPDX-License-Identifier: MIT
 #include "../BuildIR.h"
 #include "../G4_IR.hpp"
 #include "../FlowGraph.h"
+#include "../LocalScheduler/LatencyTable.h"
 
 namespace vISA {
 
@@ -28,14 +29,22 @@ public:
 
   void ALUInstructionProfile(G4_INST *inst);
 
+  // Estimate the issue cycles of one execution of bb from the final code,
+  // split into ALU issue/dependence, send issue and SWSB token waits.
+  void throughputProfile(G4_BB *bb, const LatencyTable &LT, uint64_t &aluCycle,
+                         uint64_t &sendCycle, uint64_t &syncCycle);
+
   void run() {
     for (auto bb : kernel.fg) {
       for (auto inst : *bb) {
         ALUInstructionProfile(inst);
       }
     }
+    kernelThroughputProfile();
   }
 
+  void kernelThroughputProfile();
+
 };
 
 } // namespace vISA
@@ -11,10 +11,17 @@ SPDX-License-Identifier: MIT
 
 using namespace vISA;
 
+void PointsToMembership::add(const G4_RegVar *var) {
+  const G4_Declare *dcl = var->getDeclare();
+  vars.set(dcl->getDeclId());
+  roots.set(dcl->getRootDeclare()->getDeclId());
+}
+
 PointsToAnalysis::PointsToAnalysis(const DECLARE_LIST &declares,
                                    unsigned int numBB)
     : numBBs(numBB), numAddrs(0),
-      indirectUses(std::make_unique<REGVAR_VECTOR[]>(numBB)) {
+      indirectUses(std::make_unique<REGVAR_VECTOR[]>(numBB)),
+      indirectUseMembership(std::make_unique<PointsToMembership[]>(numBB)) {
   for (auto decl : declares) {
     // add alias check, For Alias Dcl
     if ((decl->getRegFile() == G4_ADDRESS || decl->getRegFile() == G4_SCALAR) &&
@@ -49,8 +56,14 @@ PointsToAnalysis::PointsToAnalysis(const DECLARE_LIST &declares,
       }
     }
 
+    regVarIndex.reserve(numAddrs);
+    for (unsigned i = 0; i < numAddrs; i++) {
+      regVarIndex[regVars[i]] = i;
+    }
+
     pointsToSets.resize(numAddrs);
     addrExpSets.resize(numAddrs);
+    pointsToMembership.resize(numAddrs);
     addrPointsToSetIndex.resize(numAddrs);
     // initially each address variable has its own points-to set
     for (unsigned i = 0; i < numAddrs; i++) {
@@ -65,6 +78,7 @@ void PointsToAnalysis::resizePointsToSet(unsigned int newsize) {
 
   pointsToSets.resize(newsize);
   addrExpSets.resize(newsize);
+  pointsToMembership.resize(newsize);
   addrPointsToSetIndex.resize(newsize);
   for (unsigned i = numAddrs; i < newsize; i++) {
     addrPointsToSetIndex[i] = i;
@@ -76,14 +90,20 @@ void PointsToAnalysis::resizePointsToSet(unsigned int newsize) {
 void PointsToAnalysis::addIndirectUseToBB(unsigned int bbId, pointInfo pt) {
   vISA_ASSERT(bbId < numBBs, "invalid basic block id");
   REGVAR_VECTOR &vec = indirectUses[bbId];
-  auto it =
-      std::find_if(vec.begin(), vec.end(), [&pt](const pointInfo &element) {
-        return element.var == pt.var && element.off == pt.off;
-      });
-
-  if (it == vec.end()) {
-    vec.push_back(pt);
+  PointsToMembership &members = indirectUseMembership[bbId];
+  // Only scan the vector when some entry for the same variable (possibly
+  // with a different offset) is already present.
+  if (members.vars.test(pt.var->getDeclare()->getDeclId())) {
+    auto it =
+        std::find_if(vec.begin(), vec.end(), [&pt](const pointInfo &element) {
+          return element.var == pt.var && element.off == pt.off;
+        });
+    if (it != vec.end())
+      return;
   }
+
+  vec.push_back(pt);
+  members.add(pt.var);
 }
 
 void PointsToAnalysis::mergePointsToSet(const G4_RegVar *addr1,
@@ -108,29 +128,54 @@ void PointsToAnalysis::addToPointsToSet(const G4_RegVar *addr, G4_AddrExp *opnd,
                    addr->getDeclare()->getRegFile() == G4_SCALAR,
                "expect address variable");
   vISA_ASSERT(addr->getId() < numAddrs, "addr id is not set");
-  int addrPTIndex = addrPointsToSetIndex[addr->getId()];
+  addToPointsToSetAt(addrPointsToSetIndex[addr->getId()], opnd, offset);
+}
+
+void PointsToAnalysis::addToPointsToSetAt(unsigned int addrPTIndex,
+                                          G4_AddrExp *opnd,
+                                          unsigned char offset) {
   REGVAR_VECTOR &vec = pointsToSets[addrPTIndex];
+  ADDREXP_VECTOR &vec1 = addrExpSets[addrPTIndex];
+  PointsToMembership &members = pointsToMembership[addrPTIndex];
   pointInfo pi = {opnd->getRegVar(), offset};
+  addrExpInfo pi1 = {opnd, offset};
 
-  auto it =
-      std::find_if(vec.begin(), vec.end(), [&pi](const pointInfo &element) {
-        return element.var == pi.var && element.off == pi.off;
-      });
+  // Neither vector can hold an entry for this variable unless its bit is
+  // set, so the common case of a new pointee needs no scan at all.
+  bool mayBePresent = members.vars.test(pi.var->getDeclare()->getDeclId());
+
+  auto it = mayBePresent ? std::find_if(vec.begin(), vec.end(),
+                                        [&pi](const pointInfo &element) {
+                                          return element.var == pi.var &&
+                                                 element.off == pi.off;
+                                        })
+                         : vec.end();
   if (it == vec.end()) {
     vec.push_back(pi);
-    DEBUG_VERBOSE("Addr " << addr->getId() << " <-- "
-                          << pi.var->getDeclare()->getName() << "\n");
+    DEBUG_VERBOSE("Addr set " << addrPTIndex << " <-- "
+                              << pi.var->getDeclare()->getName() << "\n");
   }
 
-  addrExpInfo pi1 = {opnd, offset};
-  ADDREXP_VECTOR &vec1 = addrExpSets[addrPTIndex];
-  auto it1 =
-      std::find_if(vec1.begin(), vec1.end(), [&pi1](addrExpInfo &element) {
-        return element.exp == pi1.exp && element.off == pi1.off;
-      });
+  auto it1 = mayBePresent ? std::find_if(vec1.begin(), vec1.end(),
+                                         [&pi1](addrExpInfo &element) {
+                                           return element.exp == pi1.exp &&
+                                                  element.off == pi1.off;
+                                         })
+                          : vec1.end();
   if (it1 == vec1.end()) {
     vec1.push_back(pi1);
   }
+
+  members.add(pi.var);
+}
+
+void PointsToAnalysis::recomputeMembership(unsigned int addrPTIndex) {
+  PointsToMembership &members = pointsToMembership[addrPTIndex];
+  members.clear();
+  for (const pointInfo &pt : pointsToSets[addrPTIndex])
+    members.add(pt.var);
+  for (const addrExpInfo &exp : addrExpSets[addrPTIndex])
+    members.add(exp.exp->getRegVar());
 }
 
 unsigned int PointsToAnalysis::getIndexOfRegVar(const G4_RegVar *r) const {
@@ -138,9 +183,8 @@ unsigned int PointsToAnalysis::getIndexOfRegVar(const G4_RegVar *r) const {
   // found. This function is useful when regvar ids
   // are reset.
 
-  const auto it = std::find(regVars.begin(), regVars.end(), r);
-  return it == regVars.end() ? UINT_MAX
-                             : static_cast<unsigned int>(it - regVars.begin());
+  auto it = regVarIndex.find(r);
+  return it == regVarIndex.end() ? UINT_MAX : it->second;
 }
 
 void PointsToAnalysis::addPointsToSetToBB(int bbId, const G4_RegVar *addr) {
@@ -634,6 +678,7 @@ void PointsToAnalysis::insertAndMergeFilledAddr(const G4_RegVar *addr1,
 
   resizePointsToSet(numAddrs + 1);
 
+  regVarIndex[addr2] = (unsigned)regVars.size();
   regVars.push_back(addr2);
 
   mergePointsToSet(addr1, addr2);
@@ -729,14 +774,16 @@ bool PointsToAnalysis::isPresentInPointsTo(const G4_RegVar *addr,
   if (id == UINT_MAX)
     return false;
 
-  const REGVAR_VECTOR &vec = pointsToSets[addrPointsToSetIndex[id]];
-  for (const pointInfo pointsTo : vec) {
-    if (pointsTo.var->getId() == var->getId()) {
-      return true;
-    }
-  }
+  unsigned int addrPTIndex = addrPointsToSetIndex[id];
+  // Before liveness numbers them, GRF regvars all share UNDEFINED_VAL as id,
+  // and LVN has always treated any pointee as a match in that case.
+  if (var->getId() == UNDEFINED_VAL)
+    return !pointsToSets[addrPTIndex].empty();
 
-  return false;
+  // Liveness gives aliases the id of their root, so pointees that share the
+  // regvar id are exactly the ones with the same root declare.
+  return pointsToMembership[addrPTIndex].roots.test(
+      var->getDeclare()->getRootDeclare()->getDeclId());
 }
 
 void PointsToAnalysis::addFillToPointsTo(unsigned int bbid, G4_RegVar *addr,
@@ -754,6 +801,7 @@ void PointsToAnalysis::addFillToPointsTo(unsigned int bbid, G4_RegVar *addr,
   REGVAR_VECTOR &vec = pointsToSets[addrPointsToSetIndex[id]];
   pointInfo pt = {newvar, 0};
   vec.push_back(pt);
+  pointsToMembership[addrPointsToSetIndex[id]].add(newvar);
 
   addIndirectUseToBB(bbid, pt);
 }
@@ -763,29 +811,8 @@ void PointsToAnalysis::patchPointsToSet(const G4_RegVar *addr, G4_AddrExp *opnd,
   vISA_ASSERT(addr->getDeclare()->getRegFile() == G4_ADDRESS,
                "expect address variable");
   unsigned int id = getIndexOfRegVar(addr);
-  int addrPTIndex = addrPointsToSetIndex[id];
-  REGVAR_VECTOR &vec = pointsToSets[addrPTIndex];
-  pointInfo pi = {opnd->getRegVar(), offset};
-
-  auto it =
-      std::find_if(vec.begin(), vec.end(), [&pi](const pointInfo &element) {
-        return element.var == pi.var && element.off == pi.off;
-      });
-  if (it == vec.end()) {
-    vec.push_back(pi);
-    DEBUG_VERBOSE("Addr " << addr->getId() << " <-- "
-                          << pi.var->getDeclare()->getName() << "\n");
-  }
-
-  addrExpInfo pi1 = {opnd, offset};
-  ADDREXP_VECTOR &vec1 = addrExpSets[addrPTIndex];
-  auto it1 =
-      std::find_if(vec1.begin(), vec1.end(), [&pi1](addrExpInfo &element) {
-        return element.exp == pi1.exp && element.off == pi1.off;
-      });
-  if (it1 == vec1.end()) {
-    vec1.push_back(pi1);
-  }
+  vISA_ASSERT(id != UINT_MAX, "Could not find addr in points to set");
+  addToPointsToSetAt(addrPointsToSetIndex[id], opnd, offset);
 }
 
 void PointsToAnalysis::removeFromPointsTo(G4_RegVar *addr,
@@ -824,13 +851,20 @@ void PointsToAnalysis::removeFromPointsTo(G4_RegVar *addr,
   }
 
   vISA_ASSERT(removed == true, "Could not find spilled ref from points to");
+  recomputeMembership(addrPointsToSetIndex[id]);
 
   // If an addr taken live-range is spilled then any basic block that has
   // an indirect use of it will no longer have it because we would have
   // inserted addr taken spill/fill code. So remove any indirect uses of
   // the var from all basic blocks. Currently this set is used when
   // constructing liveness sets before RA.
+  unsigned int rootId =
+      vartoremove->getDeclare()->getRootDeclare()->getDeclId();
   for (unsigned int i = 0; i < numBBs; i++) {
+    PointsToMembership &members = indirectUseMembership[i];
+    if (!members.roots.test(rootId))
+      continue;
+
     REGVAR_VECTOR &vec = indirectUses[i];
 
     for (REGVAR_VECTOR::iterator it = vec.begin(); it != vec.end(); it++) {
@@ -838,6 +872,9 @@ void PointsToAnalysis::removeFromPointsTo(G4_RegVar *addr,
 
       if (cur.var->getId() == vartoremove->getId()) {
         vec.erase(it);
+        members.clear();
+        for (const pointInfo &pt : vec)
+          members.add(pt.var);
         break;
       }
     }
@@ -14,6 +14,7 @@ SPDX-License-Identifier: MIT
 #include <vector>
 
 #include "Assertions.h"
+#include "BitSet.h"
 //#include "common.h"
 #include "FlowGraph.h"
 //#include "G4_BB.hpp"
@@ -35,6 +36,24 @@ typedef std::vector<pointInfo> REGVAR_VECTOR;
 typedef std::vector<addrExpInfo> ADDREXP_VECTOR;
 typedef std::vector<G4_RegVar *> ORG_REGVAR_VECTOR;
 
+// Flattened membership of a points-to set (or of a BB's indirect uses) keyed
+// by declare id, so that insertion, de-duplication, removal and membership
+// queries don't need to scan the corresponding REGVAR_VECTOR. Declare ids are stable for the
+// lifetime of the kernel, unlike regvar ids which are reassigned by each
+// liveness run.
+struct PointsToMembership {
+  // decl id of every pointee regvar (or of its addr exp)
+  llvm_SBitVector vars;
+  // decl id of the root declare of every pointee regvar
+  llvm_SBitVector roots;
+
+  void add(const G4_RegVar *var);
+  void clear() {
+    vars.clear();
+    roots.clear();
+  }
+};
+
 /*
  *  Performs flow-insensitive points-to analysis.
  *  Points-to analysis is performed once at the beginning of RA,
@@ -58,6 +77,12 @@ private:
   std::vector<unsigned> addrPointsToSetIndex;
   // original regvar ptrs
   ORG_REGVAR_VECTOR regVars;
+  // regvar ptr -> index in regVars
+  std::unordered_map<const G4_RegVar *, unsigned> regVarIndex;
+  // membership of each entry in pointsToSets and addrExpSets
+  std::vector<PointsToMembership> pointsToMembership;
+  // membership of each BB's indirectUses
+  const std::unique_ptr<PointsToMembership[]> indirectUseMembership;
 
   void resizePointsToSet(unsigned int newsize);
 
@@ -70,6 +95,11 @@ private:
   void addToPointsToSet(const G4_RegVar *addr, G4_AddrExp *opnd,
                         unsigned char offset);
 
+  void addToPointsToSetAt(unsigned int addrPTIndex, G4_AddrExp *opnd,
+                          unsigned char offset);
+
+  void recomputeMembership(unsigned int addrPTIndex);
+
   // Merge addr2's points-to set into addr1's
   // basically we copy the content of addr2's points-to to addr1,
   // and have addr2 point to addr1's points-to set
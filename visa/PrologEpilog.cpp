@@ -964,12 +964,21 @@ void Optimizer::insertFenceAtEntry() {
   bool injectEntryFences = builder.getOption(vISA_InjectEntryFences);
   // for vector path this option is the same as vISA_LSC_BackupMode
   // and that option is, in turn, same as the value in WA table
+  //
+  // The options are shared by all kernels, which may be compiled
+  // concurrently (c.f. CISA_IR_Builder::compileFunctionsInParallel, which
+  // settles this option up front), so it is only written when it changes.
+  auto enableBackupMode = [&]() {
+    if (!builder.getOption(vISA_LSCBackupMode))
+      const_cast<Options *>(builder.getOptions())
+          ->setOption(vISA_LSCBackupMode, true);
+  };
   if (kernel.getInt32KernelAttr(Attributes::ATTR_Target) == VISA_CM) {
     injectEntryFences = injectEntryFences ||
                         builder.getOption(vISA_LSCBackupMode) ||
                         VISA_WA_CHECK(builder.getPWaTable(), Wa_14010198302);
-    const_cast<Options *>(builder.getOptions())
-        ->setOption(vISA_LSCBackupMode, injectEntryFences);
+    if (injectEntryFences)
+      enableBackupMode();
   }
 
   if (injectEntryFences) {
@@ -981,12 +990,11 @@ void Optimizer::insertFenceAtEntry() {
     builder.translateLscFence(nullptr, SFID::UGM, LSC_FENCE_OP_EVICT,
                               LSC_SCOPE_GPU);
     // according to architects the invalidate fence should not use backup mode
-    const_cast<Options *>(builder.getOptions())
-        ->setOption(vISA_LSCBackupMode, false);
+    builder.noLscBackupModeFence = true;
     builder.translateLscFence(nullptr, SFID::UGM, LSC_FENCE_OP_INVALIDATE,
                               LSC_SCOPE_GPU);
-    const_cast<Options *>(builder.getOptions())
-        ->setOption(vISA_LSCBackupMode, true);
+    builder.noLscBackupModeFence = false;
+    enableBackupMode();
     entryBB->insert(iter, builder.instList.begin(), builder.instList.end());
     builder.instList.clear();
   }
@@ -112,6 +112,9 @@ struct Timer {
 static vISA::Timer timers[static_cast<int>(TimerID::NUM_TIMERS)];
 static LARGE_INTEGER proc_freq;
 static int numTimers = static_cast<int>(TimerID::NUM_TIMERS);
+static thread_local bool timersDisabled = false;
+
+void disableTimersOnThisThread() { timersDisabled = true; }
 
 void initTimer() {
 
@@ -156,6 +159,8 @@ int createNewTimer(const char *name) {
 void startTimer(TimerID timerId) {
   int timer = static_cast<int>(timerId);
 #ifdef MEASURE_COMPILATION_TIME
+  if (timersDisabled)
+    return;
   if (timer < static_cast<int>(TimerID::NUM_TIMERS)) {
 #if defined(_DEBUG) && defined(CHECK_TIMER)
     if (timers[timer].started) {
@@ -183,6 +188,8 @@ void startTimer(TimerID timerId) {
 void stopTimer(TimerID timerId) {
   int timer = static_cast<int>(timerId);
 #ifdef MEASURE_COMPILATION_TIME
+  if (timersDisabled)
+    return;
   if (timer < static_cast<int>(TimerID::NUM_TIMERS)) {
     LARGE_INTEGER stop;
     QueryPerformanceCounter(&stop);
@@ -44,6 +44,9 @@ void stopTimer(TimerID timer);
 void dumpAllTimers(const char *asmFileName, bool outputTime = false);
 void dumpEncoderStats(Options *opt, std::string &asmName);
 void resetPerKernel();
+// The timers are global and not thread safe. Worker threads that compile in
+// parallel with the main one call this so their start/stop calls are ignored.
+void disableTimersOnThisThread();
 // double getTimerUS(unsigned idx);
 
 struct TimerScope {
@@ -85,6 +85,7 @@ public:
     m_genx_binary_buffer = NULL;
     m_genx_debug_info_size = 0;
     m_genx_debug_info_buffer = NULL;
+    m_genx_debug_info_sink = nullptr;
     m_bytes_written_cisa_buffer = 0;
     m_input_offset = 0;
     m_num_pred_vars = 0;
@@ -998,6 +999,8 @@ public:
   VISA_BUILDER_API int GetErrorMessage(const char *&errorMsg) const override;
   VISA_BUILDER_API virtual int
   GetGenxDebugInfo(void *&buffer, unsigned int &size) const override;
+  VISA_BUILDER_API int
+  SetGenxDebugInfoSink(vISA::DebugInfoSink *sink) override;
   /// GetGenRelocEntryBuffer -- allocate and return a buffer of all
   /// GenRelocEntry that are created by vISA
   VISA_BUILDER_API int
@@ -1292,6 +1295,7 @@ private:
   char *m_genx_binary_buffer;
   unsigned long m_genx_debug_info_size;
   char *m_genx_debug_info_buffer;
+  vISA::DebugInfoSink *m_genx_debug_info_sink;
   vISA::FINALIZER_INFO *m_jitInfo;
   KERNEL_INFO *m_kernelInfo;
 
@@ -8633,6 +8633,11 @@ int VISAKernelImpl::GetGenxDebugInfo(void *&buffer, unsigned int &size) const {
   return VISA_SUCCESS;
 }
 
+int VISAKernelImpl::SetGenxDebugInfoSink(vISA::DebugInfoSink *sink) {
+  m_genx_debug_info_sink = sink;
+  return VISA_SUCCESS;
+}
+
 int VISAKernelImpl::GetJitInfo(FINALIZER_INFO *&jitInfo) const {
   jitInfo = m_jitInfo;
   return VISA_SUCCESS;
@@ -9092,6 +9097,12 @@ void VISAKernelImpl::computeAndEmitDebugInfo(KernelListTy &functions) {
     curKernel.getKernelDebugInfo()->computeDebugInfo(stackCallEntryBBs);
   }
 
+  if (m_genx_debug_info_sink) {
+    // The client takes the mapping tables directly, skip the binary
+    // serialization it would otherwise have to decode again.
+    emitDebugInfoToSink(this, functions, *m_genx_debug_info_sink);
+  }
+
 #ifndef DLL_MODE
   if (getOptions()->getOption(vISA_outputToFile)) {
     std::string asmNameStr = getOutputAsmPath();
@@ -9099,10 +9110,12 @@ void VISAKernelImpl::computeAndEmitDebugInfo(KernelListTy &functions) {
     emitDebugInfo(this, functions, debugFileNameStr);
   }
 #else
-  void *ptr;
-  unsigned size;
-  emitDebugInfoToMem(this, functions, ptr, size);
-  setGenxDebugInfoBuffer((char *)ptr, size);
+  if (!m_genx_debug_info_sink) {
+    void *ptr;
+    unsigned size;
+    emitDebugInfoToMem(this, functions, ptr, size);
+    setGenxDebugInfoBuffer((char *)ptr, size);
+  }
 #endif
 }
 
@@ -9136,6 +9149,10 @@ void VISAKernelImpl::addFuncPerfStats(const PERF_STATS_VERBOSE& input) {
   myStats.AfterWriteTokenDepCount += input.AfterWriteTokenDepCount;
   myStats.AfterReadTokenDepCount += input.AfterReadTokenDepCount;
 
+  myStats.domRebuildNum += input.domRebuildNum;
+  myStats.postDomRebuildNum += input.postDomRebuildNum;
+  myStats.loopRebuildNum += input.loopRebuildNum;
+
   // Note: these two profiling info are collected during assembly instruction
   // emission, which happened after stitching so doesn't need to sum them:
   // PERF_STATS_VERBOSE::BCNum and PERF_STATS_VERBOSE::numRMWs
@@ -139,7 +139,7 @@ G4_INST *IR_Builder::translateLscFence(G4_Predicate *pred, SFID sfid,
     // backup mode.  Without bit 18 set, the default behavior is for
     // the UGM fence to be rerouted to HDC when the backup mode chicken
     // bit is set.
-    desc |= getOption(vISA_LSCBackupMode) << 18;
+    desc |= (getOption(vISA_LSCBackupMode) && !noLscBackupModeFence) << 18;
   }
 
   G4_SendDescRaw *msgDesc = createSendMsgDesc(sfid, desc, exDesc, src1Len,
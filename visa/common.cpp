@@ -128,7 +128,8 @@ bool DebugFlag = false;
 bool DebugAllFlag = false;
 
 // This should set by each pass via setCurrentDebugPass()
-static const char *CurrentDebugPass = nullptr;
+// Per thread since stack-call functions may be compiled concurrently.
+static thread_local const char *CurrentDebugPass = nullptr;
 // This is set when processing the vISA "-debug-only" option.
 static std::vector<std::string> PassesToDebug;
 
@@ -10,13 +10,28 @@ SPDX-License-Identifier: MIT
 
 bool assemble(const Opts &opts, igax::Context &ctx,
               const std::string &inpFile) {
-  std::string inpText;
+  // files are mapped and assembled in place rather than copied
+  iga::MappedFile inpMapping;
+  std::string stdinText;
+  const char *inpText;
+  size_t inpLen;
   if (inpFile == IGA_STDIN_FILENAME) {
     igax::Bits stdinBits = readBinaryStreamStdin();
     stdinBits.push_back(0); // NUL
-    inpText = (const char *)stdinBits.data();
+    stdinText = (const char *)stdinBits.data();
+    inpText = stdinText.c_str();
+    inpLen = stdinText.size();
   } else {
-    inpText = readTextFile(inpFile.c_str());
+    if (!inpMapping.open(inpFile)) {
+      fatalExitWithMessage(inpFile, ": failed to open file (",
+                           iga::LastErrorString(), ")");
+    }
+    inpText = inpMapping.data();
+    inpLen = inpMapping.size();
+  }
+
+  if (opts.parseBenchIterations > 0) {
+    return benchmarkParse(opts, inpFile, inpText, inpLen);
   }
 
   igax::Bits bits;
@@ -28,7 +43,7 @@ bool assemble(const Opts &opts, igax::Context &ctx,
 }
 
 bool assemble(const Opts &opts, igax::Context &ctx, const std::string &,
-              const std::string &inpText, igax::Bits &bits) {
+              const char *inpText, igax::Bits &bits) {
   iga_assemble_options_t aopts = IGA_ASSEMBLE_OPTIONS_INIT();
   aopts.enabled_warnings = opts.enabledWarnings;
 
@@ -41,6 +56,11 @@ bool assemble(const Opts &opts, igax::Context &ctx, const std::string &,
             opts.useNativeEncoder);
   setOptBit(aopts.encoder_opts, IGA_ENCODER_OPT_FORCE_NO_COMPACT,
             opts.forceNoCompact);
+  setOptBit(aopts.encoder_opts, IGA_ENCODER_OPT_FAST_ENCODE, opts.fastEncode);
+  setOptBit(aopts.encoder_opts, IGA_ENCODER_OPT_VERIFY_FAST_ENCODE,
+            opts.verifyFastEncode);
+  setOptBit(aopts.encoder_opts, IGA_ENCODER_OPT_MEMOIZE_COMPACTION,
+            opts.memoizeCompaction);
   setOptBit(aopts.syntax_opts, IGA_SYNTAX_OPT_LEGACY_SYNTAX,
             opts.legacyDirectives);
   setOptBit(aopts.syntax_opts, IGA_SYNTAX_OPT_EXTENSIONS, opts.syntaxExts);
@@ -48,14 +68,17 @@ bool assemble(const Opts &opts, igax::Context &ctx, const std::string &,
 
   try {
     auto r = ctx.assembleFromString(inpText, aopts);
-    for (auto &w : r.warnings) {
-      emitWarningToStderr(w, inpText);
+    if (!r.warnings.empty()) {
+      const std::string src = inpText;
+      for (auto &w : r.warnings) {
+        emitWarningToStderr(w, src);
+      }
     }
     bits = r.value;
     return true;
   } catch (const igax::AssembleError &err) {
     for (auto &e : err.errors) {
-      emitErrorToStderr(e, inpText);
+      emitErrorToStderr(e, err.source);
     }
     if (err.errors.empty()) {
       // e.g. some failures don't have diagnostics
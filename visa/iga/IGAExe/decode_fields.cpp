@@ -44,7 +44,7 @@ static void parseBitsFromFile(const std::string &inpFile,
     igax::Context ctx(opts.platform);
     std::string inpText = readTextFile(inpFile.c_str());
     ifXdcmpCheckForNonCompacted(opts0.mode, inpText);
-    if (!assemble(opts, ctx, inpFile, inpText, bits)) {
+    if (!assemble(opts, ctx, inpFile, inpText.c_str(), bits)) {
       errorInFile(opts, inpFile, "failed to assemble file");
     }
   } else {
@@ -59,7 +59,7 @@ static void parseBitsAsSyntax(const std::string &inp, Opts &opts,
   igax::Context ctx(opts.platform);
   Opts opts1 = opts;
   ifXdcmpCheckForNonCompacted(opts.mode, inp);
-  if (!assemble(opts, ctx, "<arg>", inp, bits)) {
+  if (!assemble(opts, ctx, "<arg>", inp.c_str(), bits)) {
     errorInFile(opts, "<arg>", "failed to assemble argument string");
   }
 }
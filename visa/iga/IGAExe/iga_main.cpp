@@ -253,6 +253,25 @@ extern "C" int iga_main(int argc, const char **argv) {
                   "set in instruction option."
                   "This will override the effect by -Xautocompact",
                   opts::OptAttrs::ALLOW_UNSET, baseOpts.forceNoCompact);
+  xGrp.defineFlag(
+      "fast-encode", nullptr, "reuse encodings of repeated instruction forms",
+      "(XE to XeHPC) The GED encoder caches the encodings of instruction forms "
+      "that repeat and encodes later occurrences by patching in their "
+      "register numbers and SWSB bits.  The output is the same; forms "
+      "the cache can't handle are still encoded with GED.",
+      opts::OptAttrs::ALLOW_UNSET, baseOpts.fastEncode);
+  xGrp.defineFlag(
+      "verify-fast-encode", nullptr, "checks -Xfast-encode against GED",
+      "Encodes every instruction -Xfast-encode handles with GED as well "
+      "and fails if the two encodings differ.",
+      opts::OptAttrs::ALLOW_UNSET, baseOpts.verifyFastEncode);
+  xGrp.defineFlag(
+      "memoize-compaction", nullptr,
+      "memoize compaction results per native encoding",
+      "Encodes every instruction natively first and caches GED's "
+      "compaction of each native encoding.  This is faster only when "
+      "the same encodings repeat; by default compaction is tried first.",
+      opts::OptAttrs::ALLOW_UNSET, baseOpts.memoizeCompaction);
   xGrp.defineFlag(
       "dcmp", nullptr, "debug compaction",
       "This mode debugs an instruction's compaction.  The input format "
@@ -363,6 +382,18 @@ extern "C" int iga_main(int argc, const char **argv) {
                   "up or if you just"
                   "like the consistency, this option enables that behavior.",
                   opts::OptAttrs::ALLOW_UNSET, baseOpts.printHexFloats);
+  xGrp.defineOpt(
+      "parse-bench", nullptr, "INT",
+      "times the assembler front end instead of assembling",
+      "Lexes and parses each input file the given number of times and "
+      "reports the throughput in MB/s.  No output is written.",
+      opts::OptAttrs::ALLOW_UNSET,
+      [](const char *cinp, const opts::ErrorHandler &eh, Opts &baseOpts) {
+        baseOpts.parseBenchIterations = eh.parseInt(cinp);
+        if (baseOpts.parseBenchIterations <= 0) {
+          eh("iteration count must be positive");
+        }
+      });
   xGrp.defineFlag("print-pc", nullptr, "print PC with each instruction",
                   "An instruction PC will be added as a comment",
                   opts::OptAttrs::ALLOW_UNSET, baseOpts.printInstructionPc);
@@ -57,6 +57,10 @@ struct Opts {
   bool syntaxExts = false;                         // -Xsyntax-exts
   bool useNativeEncoder = false;                   // -Xnative
   bool forceNoCompact = false;                     // -Xforce-no-compact
+  bool fastEncode = false;                         // -Xfast-encode
+  bool verifyFastEncode = false;                   // -Xverify-fast-encode
+  bool memoizeCompaction = false;                  // -Xmemoize-compaction
+  int parseBenchIterations = 0;                    // -Xparse-bench
   uint32_t pcOffset = 0; // pcOffset provided with -Xset-pc-base
 
   bool printBits = false;          // -Xprint-bits
@@ -75,8 +79,11 @@ bool disassemble(const Opts &opts, igax::Context &ctx,
 bool assemble(const Opts &opts, igax::Context &ctx,
               const std::string &inpFile); // -a: assemble.cpp
 bool assemble(const Opts &opts, igax::Context &ctx, const std::string &inpFile,
-              const std::string &inpText,
+              const char *inpText,
               igax::Bits &bits); // assemble.cpp
+bool benchmarkParse(const Opts &opts, const std::string &inpFile,
+                    const char *inpText,
+                    size_t inpLen); // -Xparse-bench: parse_bench.cpp
 bool decodeInstructionFields(
     const Opts &baseOpts);       // -Xifs in decode_fields.cpp
 bool debugCompaction(Opts opts); // -Xdcmp in decode_fields.cpp
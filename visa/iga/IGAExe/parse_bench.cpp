@@ -0,0 +1,75 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#include "iga_main.hpp"
+
+#include "ErrorHandler.hpp"
+#include "Frontend/BufferedLexer.hpp"
+#include "Frontend/KernelParser.hpp"
+#include "Models/Models.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+using Clock = std::chrono::steady_clock;
+
+static void emitThroughput(const char *what, Clock::duration elapsed,
+                           int iterations, size_t inpLen) {
+  double secs = std::chrono::duration<double>(elapsed).count();
+  double mbs = secs > 0.0 ? (double)inpLen * iterations / secs / 1e6 : 0.0;
+  std::cout << "  " << std::left << std::setw(8) << what << std::right
+            << std::fixed << std::setprecision(3) << std::setw(12)
+            << secs * 1000.0 / iterations << " ms/iteration" << std::setw(12)
+            << std::setprecision(1) << mbs << " MB/s\n";
+}
+
+// Times the lexer alone and then the full front end (lexing, parsing and
+// block inference) over the same in-memory input.
+bool benchmarkParse(const Opts &opts, const std::string &inpFile,
+                    const char *inpText, size_t inpLen) {
+  const iga::Model *model =
+      iga::Model::LookupModel(iga::ToPlatform(opts.platform));
+  if (model == nullptr) {
+    fatalExitWithMessage(inpFile, ": unsupported platform");
+  }
+  iga::ParseOpts popts(*model);
+  popts.supportLegacyDirectives = opts.legacyDirectives;
+
+  const int iterations = opts.parseBenchIterations;
+  size_t tokens = 0, symbols = 0;
+  auto lexStart = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    iga::BufferedLexer lexer(std::string_view(inpText, inpLen));
+    tokens = lexer.GetTokenCount();
+    symbols = lexer.GetSymbols().size();
+  }
+  auto lexTime = Clock::now() - lexStart;
+
+  auto parseStart = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    iga::ErrorHandler eh;
+    iga::Kernel *k = iga::ParseGenKernel(*model, inpText, eh, popts);
+    bool failed = k == nullptr || eh.hasErrors();
+    delete k;
+    if (failed) {
+      std::cerr << inpFile << ": parse failed "
+                << "(assemble without -Xparse-bench for diagnostics)\n";
+      return false;
+    }
+  }
+  auto parseTime = Clock::now() - parseStart;
+
+  std::cout << inpFile << ": " << inpLen << " bytes, " << tokens
+            << " tokens, " << symbols << " distinct identifiers, "
+            << iterations << " iterations\n";
+  emitThroughput("lex", lexTime, iterations, inpLen);
+  emitThroughput("parse", parseTime, iterations, inpLen);
+  return true;
+}
@@ -0,0 +1,358 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+// Instruction forms that repeat with different registers, immediates and
+// SWSB annotations, so that the encoder builds and reuses fast-path
+// templates. Assembled for each platform by fast_encode.cmake.
+        mov (8|M0) r84.0<1>:w r7.0<1;1,0>:w
+        add (16|M0) r117.0<1>:f r65.0<1;1,0>:f r28.0<1;1,0>:f
+        mul (1|M0) r12.0<1>:d r71.0<0;1,0>:d r55.0<0;1,0>:d
+        add (8|M0) r74.0<1>:hf r75.0<1;1,0>:hf r51.0<1;1,0>:hf
+        mov (16|M0) r38.0<1>:d r54.0<1;1,0>:d
+        mov (16|M0) r105.0<1>:f r88.0<1;1,0>:f
+        add (8|M0) r71.0<1>:ud r92.0<1;1,0>:ud r9.0<1;1,0>:ud {@5}
+        mov (16|M0) r100.0<1>:f r41.0<1;1,0>:f {@4}
+        mul (8|M0) r11.0<1>:d r74.0<1;1,0>:d r39.0<1;1,0>:d {@3}
+        mad (16|M0) r10.0<1>:f r16.0<1;0>:f r66.0<1;0>:f r54.0<1>:f
+        mov (16|M0) r6.0<1>:f r86.0<1;1,0>:f
+        and (16|M0) r77.0<1>:ud r64.0<1;1,0>:ud r75.0<1;1,0>:ud {$2.dst}
+        mov (16|M0) r88.0<1>:f r106.0<1;1,0>:f {@6}
+        add (16|M0) r46.0<1>:f r22.0<1;1,0>:f r79.0<1;1,0>:f
+        mov (16|M0) r95.0<1>:d r32.0<1;1,0>:d {@7}
+        or (8|M0) r71.0<1>:w r36.0<1;1,0>:w r114.0<1;1,0>:w
+        or (16|M0) r46.0<1>:ud r88.0<1;1,0>:ud r114.0<1;1,0>:ud {@2}
+        mov (8|M0) r30.0<1>:d r85.0<1;1,0>:d
+        and (16|M0) r37.0<1>:d r1.0<1;1,0>:d r19.0<1;1,0>:d {@3}
+        mad (16|M0) r89.0<1>:f r110.0<1;0>:f r66.0<1;0>:f r80.0<1>:f {$1.dst}
+        add (16|M0) r52.0<1>:f r51.0<1;1,0>:f r14.0<1;1,0>:f {@4}
+        mov (1|M0) r27.0<1>:d r57.0<0;1,0>:d
+        mov (1|M0) r14.0<1>:d r1.0<0;1,0>:d {@5}
+        mov (16|M0) r4.0<1>:f r10.0<1;1,0>:f {$12.src}
+        mov (16|M0) r78.0<1>:ud r47.0<1;1,0>:ud {@1}
+        mov (16|M0) r62.0<1>:ud r107.0<1;1,0>:ud {$0.dst}
+        mov (16|M0) r19.0<1>:ud r89.0<1;1,0>:ud {@1}
+        mul (8|M0) r69.0<1>:ud r70.0<1;1,0>:ud r100.0<1;1,0>:ud {@6}
+        mov (8|M0) r105.0<1>:d r52.0<1;1,0>:d {$7.dst}
+        mov (16|M0) r94.0<1>:ud r4.0<1;1,0>:ud {$8.src}
+        add (8|M0) r58.0<1>:hf r104.0<1;1,0>:hf r120.0<1;1,0>:hf {$11.dst}
+        cmp (16|M0) (lt)f0.0 null<1>:d r29.0<1;1,0>:d r14.0<1;1,0>:d
+        mov (8|M0) r80.0<1>:w r116.0<1;1,0>:w {$0.dst}
+        add (16|M0) r117.0<1>:f r50.0<1;1,0>:f r101.0<1;1,0>:f {$6.dst}
+        and (8|M0) r12.0<1>:w r103.0<1;1,0>:w r93.0<1;1,0>:w {@4}
+        mad (1|M0) r93.0<1>:f r21.0<1;0>:f r22.0<1;0>:f r17.0<1>:f
+        or (16|M0) r85.0<1>:d r120.0<1;1,0>:d r45.0<1;1,0>:d
+        add (1|M0) r103.0<1>:d r93.0<0;1,0>:d r84.0<0;1,0>:d
+        mad (8|M0) r112.0<1>:f r25.0<1;0>:f r106.0<1;0>:f r112.0<1>:f
+        mov (16|M0) r31.0<1>:f r98.0<1;1,0>:f {@3}
+        add (8|M0) r115.0<1>:f r59.0<1;1,0>:f r85.0<1;1,0>:f {@5}
+        mul (16|M0) r68.0<1>:d r66.0<1;1,0>:d r3.0<1;1,0>:d {$5.src}
+        mad (8|M0) r19.0<1>:f r61.0<1;0>:f r80.0<1;0>:f r93.0<1>:f
+        mov (16|M0) r72.0<1>:f r62.0<1;1,0>:f {$3.dst}
+        add (1|M0) r32.0<1>:d r25.0<0;1,0>:d -5:d
+        mov (16|M0) r4.0<1>:f r98.0<1;1,0>:f {$2.src}
+        mul (16|M0) r89.0<1>:f r36.0<1;1,0>:f r58.0<1;1,0>:f {@7}
+        add (8|M0) r119.0<1>:hf r72.0<1;1,0>:hf r115.0<1;1,0>:hf {$14.src}
+        mov (1|M0) r51.0<1>:d r57.0<0;1,0>:d {@6}
+        mov (1|M0) r28.0<1>:d r86.0<0;1,0>:d {@1}
+        add (8|M0) r19.0<1>:d r33.0<1;1,0>:d -23:d {$7.src}
+        mad (1|M0) r51.0<1>:f r114.0<1;0>:f r63.0<1;0>:f r21.0<1>:f {$7.src}
+        mov (16|M0) r52.0<1>:f r44.0<1;1,0>:f {@3}
+        mov (16|M0) r44.0<1>:f r71.0<1;1,0>:f {@6}
+        mov (16|M0) r80.0<1>:f r38.0<1;1,0>:f {@1}
+        mov (8|M0) r11.0<1>:f r34.0<1;1,0>:f
+        add (8|M0) r97.0<1>:d r17.0<1;1,0>:d 14:d {$8.src}
+        add (16|M0) r90.0<1>:f r42.0<1;1,0>:f r12.0<1;1,0>:f
+        add (1|M0) r103.0<1>:d r34.0<0;1,0>:d -30:d {$7.dst}
+        mov (1|M0) r59.0<1>:d r2.0<0;1,0>:d {@5}
+        mul (16|M0) r6.0<1>:f r68.0<1;1,0>:f r91.0<1;1,0>:f
+        mov (8|M0) r7.0<1>:ud r24.0<1;1,0>:ud
+        mov (16|M0) r98.0<1>:f r27.0<1;1,0>:f
+        and (8|M0) r103.0<1>:ud r3.0<1;1,0>:ud r33.0<1;1,0>:ud
+        mov (16|M0) r25.0<1>:f r66.0<1;1,0>:f {@4}
+        mov (16|M0) r70.0<1>:f r107.0<1;1,0>:f {$9.src}
+        mad (8|M0) r26.0<1>:f r107.0<1;0>:f r113.0<1;0>:f r91.0<1>:f {$4.dst}
+        mul (16|M0) r2.0<1>:f r10.0<1;1,0>:f r81.0<1;1,0>:f {$8.dst}
+        add (1|M0) r86.0<1>:d r108.0<0;1,0>:d r49.0<0;1,0>:d {$9.src}
+        add (16|M0) r24.0<1>:f r21.0<1;1,0>:f r35.0<1;1,0>:f {@3}
+        add (16|M0) r32.0<1>:f r5.0<1;1,0>:f r113.0<1;1,0>:f {@3}
+        mov (16|M0) r11.0<1>:f r61.0<1;1,0>:f
+        mad (8|M0) r100.0<1>:f r1.0<1;0>:f r12.0<1;0>:f r34.0<1>:f {$4.src}
+        or (1|M0) r3.0<1>:d r39.0<0;1,0>:d r39.0<0;1,0>:d {$2.dst}
+        or (16|M0) r98.0<1>:d r42.0<1;1,0>:d r93.0<1;1,0>:d {$4.src}
+        mov (16|M0) r6.0<1>:d r106.0<1;1,0>:d {$13.src}
+        mad (16|M0) r117.0<1>:f r68.0<1;0>:f r97.0<1;0>:f r65.0<1>:f {@7}
+        mov (16|M0) r49.0<1>:f r107.0<1;1,0>:f {@1}
+        mad (16|M0) r63.0<1>:f r34.0<1;0>:f r1.0<1;0>:f r59.0<1>:f {$2.dst}
+        mad (1|M0) r96.0<1>:f r95.0<1;0>:f r61.0<1;0>:f r33.0<1>:f {$8.src}
+        mov (8|M0) r95.0<1>:d r84.0<1;1,0>:d {$15.src}
+        mov (16|M0) r73.0<1>:f r18.0<1;1,0>:f
+        mov (16|M0) r89.0<1>:f r28.0<1;1,0>:f {$9.dst}
+        mad (16|M0) r60.0<1>:f r60.0<1;0>:f r99.0<1;0>:f r16.0<1>:f {$6.src}
+        mov (1|M0) r120.0<1>:d r61.0<0;1,0>:d
+        add (16|M0) r50.0<1>:f r27.0<1;1,0>:f r118.0<1;1,0>:f {$6.src}
+        mov (1|M0) r19.0<1>:d r96.0<0;1,0>:d {@3}
+        mov (16|M0) r114.0<1>:ud r15.0<1;1,0>:ud {$7.dst}
+        add (16|M0) r21.0<1>:f r1.0<1;1,0>:f r63.0<1;1,0>:f {$12.dst}
+        mov (8|M0) r45.0<1>:w r49.0<1;1,0>:w {@7}
+        mov (16|M0) r108.0<1>:ud r51.0<1;1,0>:ud
+        add (1|M0) r116.0<1>:d r95.0<0;1,0>:d -3:d
+        mov (16|M0) r10.0<1>:f r47.0<1;1,0>:f {$8.src}
+        add (16|M0) r7.0<1>:d r107.0<1;1,0>:d -4:d {$4.dst}
+        mov (16|M0) r66.0<1>:f r41.0<1;1,0>:f
+        add (16|M0) r117.0<1>:f r113.0<1;1,0>:f r71.0<1;1,0>:f {@6}
+        mov (16|M0) r79.0<1>:f r97.0<1;1,0>:f
+        add (16|M0) r117.0<1>:d r119.0<1;1,0>:d 30:d
+        and (16|M0) r33.0<1>:ud r95.0<1;1,0>:ud r95.0<1;1,0>:ud {$8.src}
+        or (8|M0) r72.0<1>:ud r86.0<1;1,0>:ud r51.0<1;1,0>:ud
+        mad (1|M0) r27.0<1>:f r65.0<1;0>:f r116.0<1;0>:f r104.0<1>:f {@2}
+        add (16|M0) r18.0<1>:f r71.0<1;1,0>:f r25.0<1;1,0>:f
+        mov (16|M0) r41.0<1>:f r31.0<1;1,0>:f {@7}
+        or (1|M0) r50.0<1>:d r53.0<0;1,0>:d r96.0<0;1,0>:d {@4}
+        mov (1|M0) r64.0<1>:d r36.0<0;1,0>:d {@3}
+        mov (16|M0) r81.0<1>:f r102.0<1;1,0>:f {$6.src}
+        mov (8|M0) r52.0<1>:w r83.0<1;1,0>:w {@3}
+        mad (16|M0) r63.0<1>:f r1.0<1;0>:f r10.0<1;0>:f r51.0<1>:f {$14.src}
+        cmp (8|M0) (lt)f0.0 null<1>:d r29.0<1;1,0>:d r20.0<1;1,0>:d
+        cmp (1|M0) (lt)f0.0 null<1>:d r106.0<0;1,0>:d r93.0<0;1,0>:d {$14.dst}
+        mov (1|M0) r1.0<1>:d r101.0<0;1,0>:d
+        and (1|M0) r17.0<1>:d r81.0<0;1,0>:d r33.0<0;1,0>:d {@4}
+        mad (1|M0) r13.0<1>:f r10.0<1;0>:f r39.0<1;0>:f r68.0<1>:f {$6.src}
+        add (8|M0) r2.0<1>:hf r69.0<1;1,0>:hf r39.0<1;1,0>:hf {$8.src}
+        cmp (8|M0) (lt)f0.0 null<1>:d r68.0<1;1,0>:d r31.0<1;1,0>:d {@1}
+        cmp (16|M0) (lt)f0.0 null<1>:d r3.0<1;1,0>:d r25.0<1;1,0>:d {@6}
+        mad (1|M0) r33.0<1>:f r30.0<1;0>:f r86.0<1;0>:f r55.0<1>:f {$7.src}
+        add (16|M0) r88.0<1>:f r51.0<1;1,0>:f r26.0<1;1,0>:f
+        mov (16|M0) r27.0<1>:f r64.0<1;1,0>:f {$9.src}
+        add (16|M0) r117.0<1>:d r86.0<1;1,0>:d -33:d {$4.src}
+        add (1|M0) r28.0<1>:d r4.0<0;1,0>:d 36:d
+        mov (1|M0) r24.0<1>:d r51.0<0;1,0>:d {@6}
+        add (1|M0) r11.0<1>:d r120.0<0;1,0>:d -19:d {@2}
+        mad (16|M0) r5.0<1>:f r40.0<1;0>:f r86.0<1;0>:f r93.0<1>:f {@3}
+        cmp (16|M0) (lt)f0.0 null<1>:d r14.0<1;1,0>:d r1.0<1;1,0>:d
+        mov (16|M0) r72.0<1>:f r98.0<1;1,0>:f
+        add (16|M0) r7.0<1>:f r91.0<1;1,0>:f r61.0<1;1,0>:f
+        and (16|M0) r47.0<1>:d r95.0<1;1,0>:d r115.0<1;1,0>:d {@6}
+        add (16|M0) r5.0<1>:f r60.0<1;1,0>:f r9.0<1;1,0>:f {$1.src}
+        mov (1|M0) r116.0<1>:d r78.0<0;1,0>:d {@3}
+        mov (16|M0) r34.0<1>:f r96.0<1;1,0>:f {$10.dst}
+        add (16|M0) r93.0<1>:d r97.0<1;1,0>:d 36:d {$2.src}
+        mov (8|M0) r61.0<1>:f r92.0<1;1,0>:f {$12.src}
+        mov (16|M0) r78.0<1>:d r31.0<1;1,0>:d {@3}
+        mul (16|M0) r51.0<1>:f r97.0<1;1,0>:f r21.0<1;1,0>:f
+        mov (1|M0) r62.0<1>:d r71.0<0;1,0>:d {@2}
+        cmp (1|M0) (lt)f0.0 null<1>:d r10.0<0;1,0>:d r34.0<0;1,0>:d {$6.dst}
+        mov (16|M0) r23.0<1>:f r30.0<1;1,0>:f
+        add (8|M0) r100.0<1>:hf r108.0<1;1,0>:hf r38.0<1;1,0>:hf
+        and (16|M0) r26.0<1>:ud r57.0<1;1,0>:ud r32.0<1;1,0>:ud
+        mov (16|M0) r25.0<1>:f r42.0<1;1,0>:f
+        mov (8|M0) r68.0<1>:hf r30.0<1;1,0>:hf {$3.dst}
+        mad (1|M0) r14.0<1>:f r1.0<1;0>:f r61.0<1;0>:f r114.0<1>:f {$14.src}
+        add (1|M0) r113.0<1>:d r38.0<0;1,0>:d -11:d
+        mov (16|M0) r120.0<1>:d r10.0<1;1,0>:d {@7}
+        mov (16|M0) r100.0<1>:ud r100.0<1;1,0>:ud {$0.dst}
+        mov (16|M0) r45.0<1>:f r28.0<1;1,0>:f
+        mov (1|M0) r27.0<1>:d r33.0<0;1,0>:d
+        mad (8|M0) r105.0<1>:f r42.0<1;0>:f r53.0<1;0>:f r87.0<1>:f {@5}
+        mov (8|M0) r102.0<1>:f r64.0<1;1,0>:f {@1}
+        mul (16|M0) r82.0<1>:f r69.0<1;1,0>:f r12.0<1;1,0>:f {$12.dst}
+        mad (16|M0) r86.0<1>:f r40.0<1;0>:f r54.0<1;0>:f r7.0<1>:f {@5}
+        add (16|M0) r3.0<1>:d r111.0<1;1,0>:d 6:d {$12.dst}
+        mad (8|M0) r56.0<1>:f r116.0<1;0>:f r21.0<1;0>:f r55.0<1>:f
+        mov (16|M0) r59.0<1>:ud r99.0<1;1,0>:ud
+        mov (16|M0) r83.0<1>:d r104.0<1;1,0>:d {$2.src}
+        mul (16|M0) r19.0<1>:f r45.0<1;1,0>:f r37.0<1;1,0>:f
+        mov (1|M0) r14.0<1>:d r50.0<0;1,0>:d {@7}
+        cmp (16|M0) (lt)f0.0 null<1>:d r7.0<1;1,0>:d r78.0<1;1,0>:d {$12.src}
+        mov (16|M0) r82.0<1>:d r101.0<1;1,0>:d {$12.src}
+        mad (8|M0) r24.0<1>:f r73.0<1;0>:f r28.0<1;0>:f r6.0<1>:f {@5}
+        mov (16|M0) r20.0<1>:f r32.0<1;1,0>:f {$6.src}
+        mov (16|M0) r86.0<1>:f r108.0<1;1,0>:f {@4}
+        or (16|M0) r40.0<1>:ud r75.0<1;1,0>:ud r32.0<1;1,0>:ud {@6}
+        mul (16|M0) r3.0<1>:f r1.0<1;1,0>:f r80.0<1;1,0>:f {$14.src}
+        mov (16|M0) r108.0<1>:f r23.0<1;1,0>:f {$12.src}
+        mov (8|M0) r56.0<1>:ud r47.0<1;1,0>:ud
+        add (16|M0) r82.0<1>:f r17.0<1;1,0>:f r11.0<1;1,0>:f {$10.src}
+        mad (8|M0) r110.0<1>:f r9.0<1;0>:f r79.0<1;0>:f r94.0<1>:f {$3.dst}
+        mov (16|M0) r104.0<1>:ud r118.0<1;1,0>:ud {$7.dst}
+        mov (16|M0) r97.0<1>:f r33.0<1;1,0>:f
+        add (16|M0) r19.0<1>:d r33.0<1;1,0>:d 24:d {$15.src}
+        mov (16|M0) r65.0<1>:f r31.0<1;1,0>:f {@1}
+        mov (16|M0) r82.0<1>:d r120.0<1;1,0>:d
+        mov (16|M0) r102.0<1>:d r101.0<1;1,0>:d
+        cmp (16|M0) (lt)f0.0 null<1>:d r67.0<1;1,0>:d r75.0<1;1,0>:d {$3.dst}
+        mov (16|M0) r95.0<1>:f r103.0<1;1,0>:f {@4}
+        cmp (16|M0) (lt)f0.0 null<1>:d r47.0<1;1,0>:d r43.0<1;1,0>:d {$14.dst}
+        mov (16|M0) r38.0<1>:f r105.0<1;1,0>:f {@3}
+        mad (16|M0) r94.0<1>:f r1.0<1;0>:f r96.0<1;0>:f r5.0<1>:f
+        mov (16|M0) r66.0<1>:f r47.0<1;1,0>:f {$4.src}
+        add (16|M0) r7.0<1>:f r1.0<1;1,0>:f r73.0<1;1,0>:f {@1}
+        or (16|M0) r75.0<1>:d r39.0<1;1,0>:d r76.0<1;1,0>:d
+        mul (16|M0) r2.0<1>:d r120.0<1;1,0>:d r103.0<1;1,0>:d
+        mov (1|M0) r9.0<1>:d r82.0<0;1,0>:d
+        mad (16|M0) r104.0<1>:f r34.0<1;0>:f r2.0<1;0>:f r8.0<1>:f {$11.dst}
+        add (16|M0) r32.0<1>:f r22.0<1;1,0>:f r116.0<1;1,0>:f
+        mov (1|M0) r52.0<1>:d r24.0<0;1,0>:d
+        mov (1|M0) r2.0<1>:d r79.0<0;1,0>:d {@2}
+        mov (8|M0) r78.0<1>:hf r83.0<1;1,0>:hf {@6}
+        and (16|M0) r9.0<1>:d r39.0<1;1,0>:d r81.0<1;1,0>:d
+        add (16|M0) r1.0<1>:d r49.0<1;1,0>:d 15:d {$14.dst}
+        mov (16|M0) r29.0<1>:d r14.0<1;1,0>:d
+        mad (1|M0) r43.0<1>:f r115.0<1;0>:f r96.0<1;0>:f r119.0<1>:f {$8.dst}
+        mad (16|M0) r87.0<1>:f r56.0<1;0>:f r88.0<1;0>:f r101.0<1>:f {$8.src}
+        mov (8|M0) r113.0<1>:f r65.0<1;1,0>:f
+        mov (8|M0) r21.0<1>:d r96.0<1;1,0>:d {$6.src}
+        add (16|M0) r31.0<1>:d r49.0<1;1,0>:d 40:d {$15.src}
+        add (16|M0) r56.0<1>:f r93.0<1;1,0>:f r30.0<1;1,0>:f {@3}
+        mov (1|M0) r15.0<1>:d r14.0<0;1,0>:d {$5.dst}
+        mov (8|M0) r4.0<1>:f r6.0<1;1,0>:f
+        mad (1|M0) r90.0<1>:f r9.0<1;0>:f r95.0<1;0>:f r6.0<1>:f
+        add (16|M0) r113.0<1>:d r112.0<1;1,0>:d r97.0<1;1,0>:d {$12.src}
+        mov (8|M0) r15.0<1>:d r5.0<1;1,0>:d
+        mul (8|M0) r38.0<1>:f r41.0<1;1,0>:f r44.0<1;1,0>:f {@1}
+        add (16|M0) r117.0<1>:f r42.0<1;1,0>:f r99.0<1;1,0>:f {$15.src}
+        add (16|M0) r101.0<1>:d r53.0<1;1,0>:d -37:d {@7}
+        mov (16|M0) r69.0<1>:f r73.0<1;1,0>:f
+        add (1|M0) r74.0<1>:d r105.0<0;1,0>:d -4:d
+        mov (8|M0) r98.0<1>:ud r97.0<1;1,0>:ud {$0.src}
+        mov (1|M0) r63.0<1>:d r89.0<0;1,0>:d {$5.dst}
+        cmp (16|M0) (lt)f0.0 null<1>:d r107.0<1;1,0>:d r66.0<1;1,0>:d
+        add (16|M0) r90.0<1>:d r30.0<1;1,0>:d 23:d
+        add (1|M0) r63.0<1>:d r101.0<0;1,0>:d 31:d {$10.dst}
+        add (16|M0) r55.0<1>:f r114.0<1;1,0>:f r83.0<1;1,0>:f
+        mov (16|M0) r116.0<1>:f r70.0<1;1,0>:f {@4}
+        cmp (8|M0) (lt)f0.0 null<1>:d r17.0<1;1,0>:d r69.0<1;1,0>:d {@6}
+        add (16|M0) r22.0<1>:f r60.0<1;1,0>:f r57.0<1;1,0>:f {$8.dst}
+        or (8|M0) r83.0<1>:ud r114.0<1;1,0>:ud r90.0<1;1,0>:ud
+        mov (16|M0) r20.0<1>:f r93.0<1;1,0>:f
+        mov (16|M0) r67.0<1>:f r45.0<1;1,0>:f
+        mov (8|M0) r94.0<1>:ud r14.0<1;1,0>:ud
+        mad (8|M0) r20.0<1>:f r19.0<1;0>:f r102.0<1;0>:f r39.0<1>:f {$13.dst}
+        mov (1|M0) r82.0<1>:d r117.0<0;1,0>:d
+        mov (16|M0) r5.0<1>:f r2.0<1;1,0>:f {@7}
+        add (8|M0) r60.0<1>:hf r3.0<1;1,0>:hf r19.0<1;1,0>:hf
+        mad (1|M0) r95.0<1>:f r32.0<1;0>:f r117.0<1;0>:f r110.0<1>:f {@5}
+        mul (16|M0) r87.0<1>:d r24.0<1;1,0>:d r83.0<1;1,0>:d
+        add (16|M0) r32.0<1>:f r101.0<1;1,0>:f r52.0<1;1,0>:f {$5.dst}
+        mov (16|M0) r59.0<1>:f r3.0<1;1,0>:f {$13.dst}
+        add (8|M0) r50.0<1>:ud r107.0<1;1,0>:ud r63.0<1;1,0>:ud {$3.src}
+        mov (16|M0) r21.0<1>:d r92.0<1;1,0>:d {$6.dst}
+        or (1|M0) r70.0<1>:d r27.0<0;1,0>:d r92.0<0;1,0>:d {@1}
+        mad (16|M0) r44.0<1>:f r53.0<1;0>:f r95.0<1;0>:f r59.0<1>:f
+        mad (16|M0) r98.0<1>:f r120.0<1;0>:f r16.0<1;0>:f r94.0<1>:f {$11.src}
+        mad (16|M0) r49.0<1>:f r52.0<1;0>:f r8.0<1;0>:f r2.0<1>:f
+        add (16|M0) r34.0<1>:d r14.0<1;1,0>:d -12:d {@4}
+        add (16|M0) r103.0<1>:d r51.0<1;1,0>:d 19:d
+        mov (1|M0) r104.0<1>:d r103.0<0;1,0>:d {$15.dst}
+        mad (8|M0) r46.0<1>:f r86.0<1;0>:f r82.0<1;0>:f r107.0<1>:f {$13.src}
+        mul (16|M0) r100.0<1>:f r107.0<1;1,0>:f r61.0<1;1,0>:f {@7}
+        mov (16|M0) r55.0<1>:ud r87.0<1;1,0>:ud
+        mov (16|M0) r32.0<1>:ud r84.0<1;1,0>:ud {@4}
+        add (16|M0) r20.0<1>:f r119.0<1;1,0>:f r39.0<1;1,0>:f {$1.src}
+        mov (16|M0) r101.0<1>:ud r18.0<1;1,0>:ud {@3}
+        mad (1|M0) r85.0<1>:f r2.0<1;0>:f r27.0<1;0>:f r10.0<1>:f {$8.dst}
+        mad (16|M0) r110.0<1>:f r30.0<1;0>:f r24.0<1;0>:f r100.0<1>:f {@7}
+        mov (16|M0) r22.0<1>:f r79.0<1;1,0>:f {$2.src}
+        mad (16|M0) r26.0<1>:f r64.0<1;0>:f r89.0<1;0>:f r28.0<1>:f {@6}
+        or (8|M0) r72.0<1>:w r8.0<1;1,0>:w r62.0<1;1,0>:w {@2}
+        mad (8|M0) r22.0<1>:f r70.0<1;0>:f r77.0<1;0>:f r111.0<1>:f {$5.dst}
+        mov (16|M0) r3.0<1>:f r79.0<1;1,0>:f
+        mad (16|M0) r66.0<1>:f r62.0<1;0>:f r63.0<1;0>:f r97.0<1>:f {$1.src}
+        mov (16|M0) r44.0<1>:d r13.0<1;1,0>:d {$11.src}
+        mov (16|M0) r99.0<1>:f r117.0<1;1,0>:f
+        add (16|M0) r106.0<1>:ud r38.0<1;1,0>:ud r38.0<1;1,0>:ud {@4}
+        and (16|M0) r27.0<1>:ud r84.0<1;1,0>:ud r64.0<1;1,0>:ud {$10.dst}
+        mov (16|M0) r76.0<1>:d r82.0<1;1,0>:d
+        cmp (16|M0) (lt)f0.0 null<1>:d r114.0<1;1,0>:d r52.0<1;1,0>:d {@1}
+        add (1|M0) r6.0<1>:d r25.0<0;1,0>:d r106.0<0;1,0>:d {$1.src}
+        mad (16|M0) r28.0<1>:f r6.0<1;0>:f r86.0<1;0>:f r82.0<1>:f {@7}
+        mov (8|M0) r54.0<1>:f r100.0<1;1,0>:f
+        add (1|M0) r48.0<1>:d r112.0<0;1,0>:d -23:d {$8.dst}
+        add (8|M0) r5.0<1>:d r41.0<1;1,0>:d -38:d {@6}
+        or (1|M0) r73.0<1>:d r67.0<0;1,0>:d r6.0<0;1,0>:d {$13.src}
+        add (16|M0) r2.0<1>:f r88.0<1;1,0>:f r50.0<1;1,0>:f {@6}
+        cmp (16|M0) (lt)f0.0 null<1>:d r71.0<1;1,0>:d r14.0<1;1,0>:d
+        add (8|M0) r1.0<1>:f r2.0<1;1,0>:f r88.0<1;1,0>:f {$2.dst}
+        mov (1|M0) r17.0<1>:d r61.0<0;1,0>:d
+        mad (8|M0) r94.0<1>:f r96.0<1;0>:f r24.0<1;0>:f r119.0<1>:f
+        add (16|M0) r2.0<1>:f r8.0<1;1,0>:f r2.0<1;1,0>:f {$2.src}
+        mul (16|M0) r111.0<1>:f r107.0<1;1,0>:f r63.0<1;1,0>:f {$10.dst}
+        add (16|M0) r87.0<1>:f r22.0<1;1,0>:f r19.0<1;1,0>:f {$3.src}
+        or (8|M0) r50.0<1>:w r100.0<1;1,0>:w r101.0<1;1,0>:w {@3}
+        mad (16|M0) r112.0<1>:f r78.0<1;0>:f r93.0<1;0>:f r2.0<1>:f {$9.src}
+        or (8|M0) r88.0<1>:w r49.0<1;1,0>:w r78.0<1;1,0>:w {$7.dst}
+        add (16|M0) r107.0<1>:f r19.0<1;1,0>:f r104.0<1;1,0>:f {$4.src}
+        mov (16|M0) r45.0<1>:f r69.0<1;1,0>:f
+        mul (16|M0) r40.0<1>:d r78.0<1;1,0>:d r8.0<1;1,0>:d {$14.dst}
+        mad (16|M0) r97.0<1>:f r2.0<1;0>:f r102.0<1;0>:f r50.0<1>:f {@1}
+        mul (16|M0) r51.0<1>:f r75.0<1;1,0>:f r67.0<1;1,0>:f {$10.src}
+        mul (16|M0) r28.0<1>:d r25.0<1;1,0>:d r12.0<1;1,0>:d
+        mad (16|M0) r73.0<1>:f r46.0<1;0>:f r52.0<1;0>:f r100.0<1>:f {@2}
+        mov (16|M0) r111.0<1>:ud r14.0<1;1,0>:ud {@4}
+        mov (16|M0) r13.0<1>:f r5.0<1;1,0>:f
+        add (16|M0) r76.0<1>:d r73.0<1;1,0>:d -13:d
+        mov (1|M0) r44.0<1>:d r26.0<0;1,0>:d {$12.src}
+        mov (1|M0) r5.0<1>:d r72.0<0;1,0>:d {@6}
+        or (1|M0) r119.0<1>:d r16.0<0;1,0>:d r91.0<0;1,0>:d {$8.src}
+        mov (8|M0) r118.0<1>:f r86.0<1;1,0>:f {@2}
+        mul (8|M0) r93.0<1>:ud r29.0<1;1,0>:ud r23.0<1;1,0>:ud
+        mov (16|M0) r116.0<1>:f r71.0<1;1,0>:f {$1.src}
+        mov (16|M0) r8.0<1>:f r13.0<1;1,0>:f
+        mov (1|M0) r48.0<1>:d r62.0<0;1,0>:d {@4}
+        mov (8|M0) r60.0<1>:f r92.0<1;1,0>:f {$1.src}
+        mov (8|M0) r120.0<1>:f r80.0<1;1,0>:f {$4.src}
+        mov (1|M0) r24.0<1>:d r92.0<0;1,0>:d {@2}
+        or (8|M0) r53.0<1>:ud r32.0<1;1,0>:ud r20.0<1;1,0>:ud
+        mul (16|M0) r34.0<1>:ud r63.0<1;1,0>:ud r14.0<1;1,0>:ud {@4}
+        mov (16|M0) r81.0<1>:f r115.0<1;1,0>:f {$6.dst}
+        add (16|M0) r97.0<1>:f r26.0<1;1,0>:f r47.0<1;1,0>:f {@3}
+        cmp (8|M0) (lt)f0.0 null<1>:d r50.0<1;1,0>:d r38.0<1;1,0>:d {@2}
+        mov (16|M0) r82.0<1>:d r3.0<1;1,0>:d {@5}
+        mov (8|M0) r1.0<1>:w r102.0<1;1,0>:w {$9.src}
+        mov (16|M0) r117.0<1>:f r53.0<1;1,0>:f
+        mul (8|M0) r92.0<1>:d r23.0<1;1,0>:d r26.0<1;1,0>:d {$2.dst}
+        add (16|M0) r23.0<1>:d r27.0<1;1,0>:d -23:d {$6.dst}
+        add (8|M0) r89.0<1>:f r94.0<1;1,0>:f r67.0<1;1,0>:f {@6}
+        add (16|M0) r43.0<1>:d r37.0<1;1,0>:d 23:d
+        and (16|M0) r32.0<1>:d r24.0<1;1,0>:d r73.0<1;1,0>:d {$11.src}
+        mov (16|M0) r77.0<1>:f r110.0<1;1,0>:f
+        add (16|M0) r16.0<1>:f r46.0<1;1,0>:f r92.0<1;1,0>:f
+        mov (1|M0) r94.0<1>:d r64.0<0;1,0>:d {@1}
+        add (16|M0) r32.0<1>:d r12.0<1;1,0>:d r29.0<1;1,0>:d {$5.dst}
+        mov (16|M0) r105.0<1>:f r4.0<1;1,0>:f
+        add (8|M0) r3.0<1>:d r108.0<1;1,0>:d 36:d {$14.dst}
+        add (16|M0) r112.0<1>:f r13.0<1;1,0>:f r92.0<1;1,0>:f
+        mov (16|M0) r75.0<1>:f r65.0<1;1,0>:f {$3.dst}
+        mov (16|M0) r70.0<1>:d r76.0<1;1,0>:d
+        mov (16|M0) r96.0<1>:f r51.0<1;1,0>:f
+        and (1|M0) r44.0<1>:d r52.0<0;1,0>:d r31.0<0;1,0>:d {$13.src}
+        mov (8|M0) r32.0<1>:ud r112.0<1;1,0>:ud {@6}
+        mov (1|M0) r68.0<1>:d r24.0<0;1,0>:d
+        mul (16|M0) r18.0<1>:f r54.0<1;1,0>:f r51.0<1;1,0>:f {$14.dst}
+        mad (1|M0) r5.0<1>:f r111.0<1;0>:f r83.0<1;0>:f r80.0<1>:f
+        mad (16|M0) r104.0<1>:f r119.0<1;0>:f r5.0<1;0>:f r80.0<1>:f
+        mov (1|M0) r56.0<1>:d r31.0<0;1,0>:d {$9.src}
+        mov (16|M0) r16.0<1>:d r8.0<1;1,0>:d {@5}
+        add (1|M0) r60.0<1>:d r76.0<0;1,0>:d 28:d {$14.src}
+        mov (8|M0) r118.0<1>:ud r53.0<1;1,0>:ud {@3}
+        mov (1|M0) r95.0<1>:d r70.0<0;1,0>:d
+        or (16|M0) r26.0<1>:d r71.0<1;1,0>:d r91.0<1;1,0>:d {@5}
+        mov (16|M0) r105.0<1>:f r40.0<1;1,0>:f
+        mov (8|M0) r70.0<1>:hf r50.0<1;1,0>:hf {$12.src}
+        mov (16|M0) r111.0<1>:d r31.0<1;1,0>:d {@3}
+        and (16|M0) r8.0<1>:d r99.0<1;1,0>:d r3.0<1;1,0>:d
+        mov (16|M0) r85.0<1>:f r8.0<1;1,0>:f {@7}
+        mul (1|M0) r87.0<1>:d r95.0<0;1,0>:d r120.0<0;1,0>:d
+        mov (16|M0) r87.0<1>:d r26.0<1;1,0>:d {$8.dst}
+        mov (8|M0) r112.0<1>:w r14.0<1;1,0>:w
+        add (16|M0) r49.0<1>:f r110.0<1;1,0>:f r58.0<1;1,0>:f {$9.dst}
+        mad (16|M0) r51.0<1>:f r68.0<1;0>:f r72.0<1;0>:f r77.0<1>:f {@3}
+        mov (16|M0) r57.0<1>:f r39.0<1;1,0>:f
+        mov (8|M0) r74.0<1>:w r49.0<1;1,0>:w {@1}
+        cmp (8|M0) (lt)f0.0 null<1>:d r115.0<1;1,0>:d r117.0<1;1,0>:d {$0.src}
+        mov (16|M0) r39.0<1>:f r118.0<1;1,0>:f {@3}
+        add (16|M0) r50.0<1>:f r60.0<1;1,0>:f r46.0<1;1,0>:f
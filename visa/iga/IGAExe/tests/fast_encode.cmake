@@ -0,0 +1,45 @@
+#=========================== begin_copyright_notice ============================
+#
+# Copyright (C) 2024 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+#============================ end_copyright_notice =============================
+
+# Assembles INPUT for PLATFORM through GED only, with the fast-path encoder
+# checked against GED (-Xverify-fast-encode), with the fast path alone and
+# with memoized compaction, with and without compaction, and requires
+# byte-identical output.
+#
+#   cmake -DIGA=<iga exe> -DINPUT=<asm> -DPLATFORM=<p> -DOUT_DIR=<dir>
+#         -P fast_encode.cmake
+
+file(MAKE_DIRECTORY ${OUT_DIR})
+
+foreach(COMPACT "" "-Xautocompact")
+  set(OPTS_ged "")
+  set(OPTS_verify "-Xverify-fast-encode")
+  set(OPTS_fast "-Xfast-encode")
+  set(OPTS_memo "-Xmemoize-compaction")
+  foreach(MODE ged verify fast memo)
+    set(OUT ${OUT_DIR}/${PLATFORM}${COMPACT}.${MODE}.krn)
+    execute_process(
+      COMMAND ${IGA} -a ${INPUT} -p=${PLATFORM} ${COMPACT} ${OPTS_${MODE}}
+              -o ${OUT}
+      RESULT_VARIABLE RESULT)
+    if(NOT RESULT EQUAL 0)
+      message(FATAL_ERROR "iga ${MODE} ${COMPACT} failed on ${PLATFORM}")
+    endif()
+  endforeach()
+  foreach(MODE verify fast memo)
+    execute_process(
+      COMMAND ${CMAKE_COMMAND} -E compare_files
+              ${OUT_DIR}/${PLATFORM}${COMPACT}.ged.krn
+              ${OUT_DIR}/${PLATFORM}${COMPACT}.${MODE}.krn
+      RESULT_VARIABLE RESULT)
+    if(NOT RESULT EQUAL 0)
+      message(FATAL_ERROR
+              "${MODE} ${COMPACT} encoding differs from GED on ${PLATFORM}")
+    endif()
+  endforeach()
+endforeach()
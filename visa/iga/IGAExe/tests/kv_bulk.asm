@@ -0,0 +1,29 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+// A kernel with compacted and native instructions, a jmpi and structured
+// branches with one and two targets, and sends with immediate and register
+// extended descriptors.  Checked by kv_bulk.cpp.
+        mov (8|M0) r10.0<1>:d r2.0<1;1,0>:d
+        add (8|M0) r11.0<1>:d r10.0<1;1,0>:d 1:d
+        cmp (8|M0) (lt)f0.0 null<1>:d r11.0<1;1,0>:d r3.0<1;1,0>:d
+(W&f0.0) jmpi (1|M0) L_SKIP
+        send.dc0 (8|M0) r20 r10 null 0x0 0x02480000 {$1}
+        mov (8|M0) r12.0<1>:d r20.0<1;1,0>:d {$1.dst}
+L_SKIP:
+(f0.0)  if (8|M0) L_ELSE L_ENDIF
+        add (8|M0) r13.0<1>:d r12.0<1;1,0>:d 2:d
+L_ELSE:
+        else (8|M0) L_ENDIF L_ENDIF
+        add (8|M0) r13.0<1>:d r12.0<1;1,0>:d 3:d
+L_ENDIF:
+        endif (8|M0) L_END
+L_END:
+        send.dc1 (8|M0) null r10 r12 a0.2 0x020A0000 {$2}
+        mov (8|M0) r127.0<1>:f r0.0<1;1,0>:f
+        send.gtwy (8|M0) null r127 null 0x0 0x02000010 {EOT}
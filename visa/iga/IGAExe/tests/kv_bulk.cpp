@@ -0,0 +1,241 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+// Checks the kv_get_insts, kv_get_branch_targets and kv_get_sends bulk
+// tables against the per-PC KernelView queries they replace.
+//
+//   kv_bulk <asm file> <platform>
+//
+// The kernel is assembled with auto-compaction so that instruction sizes
+// vary.  Every send in it must have at least one immediate descriptor; the
+// per-PC kv_get_send_descs cannot tell a send with two register
+// descriptors from a non-send.
+
+#include "api/iga.h"
+#include "api/kv.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static int s_failures = 0;
+
+#define CHECK(X)                                                               \
+  do {                                                                         \
+    if (!(X)) {                                                                \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #X       \
+                << "\n";                                                       \
+      s_failures++;                                                            \
+    }                                                                          \
+  } while (0)
+
+static bool lookupPlatform(const std::string &name, iga_gen_t &gen) {
+  static const struct {
+    const char *name;
+    iga_gen_t gen;
+  } PLATFORMS[] = {
+      {"12p1", IGA_XE},
+      {"12p5", IGA_XE_HP},
+      {"12p71", IGA_XE_HPG},
+      {"12p72", IGA_XE_HPC},
+  };
+  for (const auto &p : PLATFORMS) {
+    if (name == p.name) {
+      gen = p.gen;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool assemble(iga_gen_t gen, const std::string &text,
+                     std::vector<unsigned char> &bits) {
+  iga_context_options_t ctxOpts = IGA_CONTEXT_OPTIONS_INIT(gen);
+  iga_context_t ctx;
+  if (iga_context_create(&ctxOpts, &ctx) != IGA_SUCCESS) {
+    std::cerr << "failed to create an IGA context\n";
+    return false;
+  }
+  iga_assemble_options_t opts = IGA_ASSEMBLE_OPTIONS_INIT();
+  opts.encoder_opts |= IGA_ENCODER_OPT_AUTO_COMPACT;
+  void *output = nullptr;
+  uint32_t outputSize = 0;
+  iga_status_t st =
+      iga_context_assemble(ctx, &opts, text.c_str(), &output, &outputSize);
+  if (st == IGA_SUCCESS) {
+    const unsigned char *bytes = (const unsigned char *)output;
+    bits.assign(bytes, bytes + outputSize);
+  } else {
+    std::cerr << "assembly failed: " << iga_status_to_string(st) << "\n";
+  }
+  iga_context_release(ctx);
+  return st == IGA_SUCCESS;
+}
+
+// The tables the per-PC queries yield, built by walking the kernel
+struct PerPcTables {
+  std::vector<int32_t> instPcs, instSizes;
+  std::vector<uint32_t> instOpcodes;
+  std::vector<int32_t> branchFromPcs, branchToPcs;
+  std::vector<int32_t> sendPcs;
+  std::vector<uint32_t> sendExDescs, sendDescs;
+};
+
+static PerPcTables walkPerPc(const kv_t *kv) {
+  PerPcTables t;
+  int32_t iLen;
+  for (int32_t pc = 0; (iLen = kv_get_inst_size(kv, pc)) != 0; pc += iLen) {
+    t.instPcs.push_back(pc);
+    t.instSizes.push_back(iLen);
+    t.instOpcodes.push_back(kv_get_opcode(kv, pc));
+
+    int32_t targets[KV_MAX_TARGETS_PER_INSTRUCTION];
+    uint32_t nTargets = kv_get_inst_targets(kv, pc, targets);
+    for (uint32_t i = 0; i < nTargets; i++) {
+      t.branchFromPcs.push_back(pc);
+      t.branchToPcs.push_back(targets[i]);
+    }
+
+    uint32_t exDesc, desc;
+    if (kv_get_send_descs(kv, pc, &exDesc, &desc) != 0) {
+      t.sendPcs.push_back(pc);
+      t.sendExDescs.push_back(exDesc);
+      t.sendDescs.push_back(desc);
+    }
+  }
+  return t;
+}
+
+template <typename T>
+static bool prefixEquals(const std::vector<T> &got,
+                         const std::vector<T> &expected, size_t n) {
+  return got.size() >= n && expected.size() >= n &&
+         std::equal(got.begin(), got.begin() + n, expected.begin());
+}
+
+// Sentinel for array elements past 'cap' that must stay untouched
+static const int32_t UNTOUCHED = 0x5A5A5A5A;
+
+static void checkInsts(const kv_t *kv, const PerPcTables &t) {
+  const uint32_t n = (uint32_t)t.instPcs.size();
+  CHECK(kv_get_inst_count(kv) == n);
+  CHECK(kv_get_insts(kv, nullptr, nullptr, nullptr, 0) == n);
+  CHECK(kv_get_insts(kv, nullptr, nullptr, nullptr, n) == n);
+
+  for (uint32_t cap : {n, n / 2, 1u, 0u}) {
+    std::vector<int32_t> pcs(n + 1, UNTOUCHED), sizes(n + 1, UNTOUCHED);
+    std::vector<uint32_t> opcodes(n + 1, (uint32_t)UNTOUCHED);
+    CHECK(kv_get_insts(kv, pcs.data(), sizes.data(), opcodes.data(), cap) ==
+          n);
+    CHECK(prefixEquals(pcs, t.instPcs, cap));
+    CHECK(prefixEquals(sizes, t.instSizes, cap));
+    CHECK(prefixEquals(opcodes, t.instOpcodes, cap));
+    CHECK(pcs[cap] == UNTOUCHED && sizes[cap] == UNTOUCHED &&
+          opcodes[cap] == (uint32_t)UNTOUCHED);
+  }
+
+  // any one array may be requested alone
+  std::vector<int32_t> sizes(n);
+  CHECK(kv_get_insts(kv, nullptr, sizes.data(), nullptr, n) == n);
+  CHECK(sizes == t.instSizes);
+}
+
+static void checkBranches(const kv_t *kv, const PerPcTables &t) {
+  const uint32_t n = (uint32_t)t.branchFromPcs.size();
+  CHECK(kv_get_branch_targets(kv, nullptr, nullptr, 0) == n);
+
+  for (uint32_t cap : {n, n / 2, 1u, 0u}) {
+    std::vector<int32_t> from(n + 1, UNTOUCHED), to(n + 1, UNTOUCHED);
+    CHECK(kv_get_branch_targets(kv, from.data(), to.data(), cap) == n);
+    CHECK(prefixEquals(from, t.branchFromPcs, cap));
+    CHECK(prefixEquals(to, t.branchToPcs, cap));
+    CHECK(from[cap] == UNTOUCHED && to[cap] == UNTOUCHED);
+  }
+
+  std::vector<int32_t> to(n);
+  CHECK(kv_get_branch_targets(kv, nullptr, to.data(), n) == n);
+  CHECK(to == t.branchToPcs);
+}
+
+static void checkSends(const kv_t *kv, const PerPcTables &t) {
+  const uint32_t n = (uint32_t)t.sendPcs.size();
+  CHECK(kv_get_sends(kv, nullptr, nullptr, nullptr, 0) == n);
+
+  for (uint32_t cap : {n, n / 2, 1u, 0u}) {
+    std::vector<int32_t> pcs(n + 1, UNTOUCHED);
+    std::vector<uint32_t> exDescs(n + 1, (uint32_t)UNTOUCHED),
+        descs(n + 1, (uint32_t)UNTOUCHED);
+    CHECK(kv_get_sends(kv, pcs.data(), exDescs.data(), descs.data(), cap) ==
+          n);
+    CHECK(prefixEquals(pcs, t.sendPcs, cap));
+    CHECK(prefixEquals(exDescs, t.sendExDescs, cap));
+    CHECK(prefixEquals(descs, t.sendDescs, cap));
+    CHECK(pcs[cap] == UNTOUCHED && exDescs[cap] == (uint32_t)UNTOUCHED &&
+          descs[cap] == (uint32_t)UNTOUCHED);
+  }
+
+  std::vector<uint32_t> descs(n);
+  CHECK(kv_get_sends(kv, nullptr, nullptr, descs.data(), n) == n);
+  CHECK(descs == t.sendDescs);
+}
+
+int main(int argc, const char **argv) {
+  iga_gen_t gen;
+  if (argc != 3 || !lookupPlatform(argv[2], gen)) {
+    std::cerr << "usage: kv_bulk <asm file> 12p1|12p5|12p71|12p72\n";
+    return 2;
+  }
+  std::ifstream ifs(argv[1]);
+  if (!ifs) {
+    std::cerr << argv[1] << ": failed to open\n";
+    return 2;
+  }
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+
+  std::vector<unsigned char> bits;
+  if (!assemble(gen, ss.str(), bits))
+    return 1;
+
+  iga_status_t st;
+  char errbuf[256];
+  kv_t *kv = kv_create(gen, bits.data(), bits.size(), &st, errbuf,
+                       sizeof(errbuf));
+  if (st != IGA_SUCCESS) {
+    std::cerr << "kv_create failed: " << errbuf << "\n";
+    kv_delete(kv);
+    return 1;
+  }
+
+  const PerPcTables t = walkPerPc(kv);
+  // the kernel must exercise every table (and compaction)
+  CHECK(!t.branchFromPcs.empty());
+  CHECK(!t.sendPcs.empty());
+  CHECK(std::find(t.instSizes.begin(), t.instSizes.end(), 8) !=
+        t.instSizes.end());
+
+  checkInsts(kv, t);
+  checkBranches(kv, t);
+  checkSends(kv, t);
+
+  // a NULL view has empty tables
+  CHECK(kv_get_insts(nullptr, nullptr, nullptr, nullptr, 0) == 0);
+  CHECK(kv_get_branch_targets(nullptr, nullptr, nullptr, 0) == 0);
+  CHECK(kv_get_sends(nullptr, nullptr, nullptr, nullptr, 0) == 0);
+
+  kv_delete(kv);
+
+  if (s_failures) {
+    std::cerr << s_failures << " check(s) failed on " << argv[2] << "\n";
+    return 1;
+  }
+  return 0;
+}
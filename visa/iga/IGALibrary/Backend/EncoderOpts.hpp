@@ -11,7 +11,45 @@ SPDX-License-Identifier: MIT
 
 #include "../api/iga_types_swsb.hpp"
 
+#include <cstdint>
+#include <ostream>
+
 namespace iga {
+// Counters an encoder accumulates when EncoderOpts::stats is set.
+//
+// The compaction cache counters come from the GED encoder's memo of
+// compaction results per native encoding (EncoderOpts::memoizeCompaction);
+// the template counters from the
+// encoding templates of its fast path (EncoderOpts::fastEncode).
+struct EncoderStats {
+  uint64_t instructions = 0;
+  // encoded bytes
+  uint64_t bytes = 0;
+  // instructions we tried to compact and the ones that were
+  uint64_t compactionAttempts = 0;
+  uint64_t compacted = 0;
+  uint64_t compactionCacheLookups = 0;
+  uint64_t compactionCacheHits = 0;
+  uint64_t templateLookups = 0;
+  uint64_t templateHits = 0;
+
+  void emit(std::ostream &os) const {
+    auto pct = [](uint64_t n, uint64_t d) {
+      return d == 0 ? 0.0 : 100.0 * (double)n / (double)d;
+    };
+    os << "instructions: " << instructions << " (" << bytes << " bytes)\n";
+    os << "compacted: " << compacted << " of " << compactionAttempts
+       << " attempted (" << pct(compacted, instructions)
+       << "% of instructions, " << compacted * 8 << " bytes saved)\n";
+    os << "compaction cache: " << compactionCacheHits << " hits of "
+       << compactionCacheLookups << " lookups ("
+       << pct(compactionCacheHits, compactionCacheLookups) << "%)\n";
+    os << "encoding templates: " << templateHits << " hits of "
+       << templateLookups << " lookups ("
+       << pct(templateHits, templateLookups) << "%)\n";
+  }
+};
+
 struct EncoderOpts {
   bool autoCompact = false;
   bool explicitCompactMissIsWarning = false;
@@ -23,6 +61,19 @@ struct EncoderOpts {
   SWSB_ENCODE_MODE swsbEncodeMode = SWSB_ENCODE_MODE::SWSBInvalidMode;
   // Specify number of sbid that can be used
   uint32_t sbidCount = 16;
+  // Reuse cached encodings for repeated instruction forms (XE+), patching
+  // only the GRF numbers and SWSB bits instead of going through GED
+  // (c.f. GED/EncodingTemplates.hpp)
+  bool fastEncode = false;
+  // Also encode every fast path instruction with GED and report an error
+  // if the two encodings differ (the GED encoding is kept)
+  bool verifyFastEncode = false;
+  // Encode native first and memoize GED's compaction of each native
+  // encoding instead of trying compaction first.  Only pays off when the
+  // same encodings repeat; otherwise the extra native encode costs more.
+  bool memoizeCompaction = false;
+  // if set the encoder adds its counters here (the caller resets it)
+  EncoderStats *stats = nullptr;
 
   EncoderOpts(bool _autoCompact = false,
               bool _explicitCompactMissIsWarning = false,
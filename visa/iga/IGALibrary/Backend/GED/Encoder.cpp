@@ -16,6 +16,7 @@ SPDX-License-Identifier: MIT
 #include "../../strings.hpp"
 #include "IGAToGEDTranslation.hpp"
 
+#include <algorithm>
 #include <cstring>
 
 using namespace iga;
@@ -122,6 +123,9 @@ void Encoder::encodeKernel(Kernel &k, MemManager &mem, void *&bits,
 
     // setting actual size
     bitsLen = currentPc();
+    if (m_opts.stats) {
+      m_opts.stats->bytes += bitsLen;
+    }
     bits = m_instBuf;
 
     applyGedWorkarounds(k, currentPc());
@@ -184,58 +188,357 @@ void Encoder::encodeBlock(Kernel &k, Block *blk) {
       continue;
     }
 
-    encodeInstruction(*inst);
-    if (hasFatalError()) {
+    // count the attempt before encoding updates {Compacted}
+    if (m_opts.stats) {
+      bool mustCompact, tryCompact;
+      getCompaction(*inst, mustCompact, tryCompact);
+      m_opts.stats->instructions++;
+      m_opts.stats->compactionAttempts += tryCompact;
+    }
+    bool encoded = m_opts.fastEncode && isTemplateCandidate(*inst)
+                       ? encodeInstructionBitsFast(*inst)
+                       : encodeInstructionBits(*inst);
+    if (!encoded) {
       return;
     }
-    setEncodedPC(inst, currentPc());
-
-    GED_RETURN_VALUE status = GED_RETURN_VALUE_SIZE;
-
-    // If -Xforce-no-compact is set, do not compact any insruction
-    // Otherwise, if {NoCompact} is set, do not compact the instruction
-    // Otherwise, if {Compacted} is set on the instruction, try to compact it
-    // and report error on fail Otherwise, if no compaction setting on the
-    // instruction, try to compact the instruction if -Xauto-compact Otherwise,
-    // do not compact the instruction
-    bool mustCompact = inst->hasInstOpt(InstOpt::COMPACTED);
-    bool mustNotCompact = inst->hasInstOpt(InstOpt::NOCOMPACT);
-    if (m_opts.forceNoCompact) {
-      mustCompact = false;
-      mustNotCompact = true;
-    }
-
-    int32_t iLen = 16;
-    if (mustCompact || (!mustNotCompact && m_opts.autoCompact)) {
-      // try compact first
-      status = GED_EncodeIns(&m_gedInst, GED_INS_TYPE_COMPACT,
-                             m_instBuf + currentPc());
-      if (status == GED_RETURN_VALUE_SUCCESS) {
-        // If auto compation is turned on, in case we need to patch later.
-        inst->addInstOpt(InstOpt::COMPACTED);
-        iLen = 8;
-      } else if (status == GED_RETURN_VALUE_NO_COMPACT_FORM) {
-        if (mustCompact) {
-          if (m_opts.explicitCompactMissIsWarning) {
-            warningAtT(inst->getLoc(), "GED unable to compact instruction");
-          } else {
-            errorAtT(inst->getLoc(), "GED unable to compact instruction");
-          }
-        }
-      } // else: some other error (unreachable?)
+    if (m_opts.stats) {
+      m_opts.stats->compacted += inst->hasInstOpt(InstOpt::COMPACTED);
     }
+  }
+}
+
+void Encoder::getCompaction(const Instruction &inst, bool &mustCompact,
+                            bool &tryCompact) const {
+  // If -Xforce-no-compact is set, do not compact any insruction
+  // Otherwise, if {NoCompact} is set, do not compact the instruction
+  // Otherwise, if {Compacted} is set on the instruction, try to compact it
+  // and report error on fail Otherwise, if no compaction setting on the
+  // instruction, try to compact the instruction if -Xauto-compact Otherwise,
+  // do not compact the instruction
+  mustCompact = inst.hasInstOpt(InstOpt::COMPACTED);
+  bool mustNotCompact = inst.hasInstOpt(InstOpt::NOCOMPACT);
+  if (m_opts.forceNoCompact) {
+    mustCompact = false;
+    mustNotCompact = true;
+  }
+  tryCompact = mustCompact || (!mustNotCompact && m_opts.autoCompact);
+}
 
-    // try native encoding if compaction failed
+bool Encoder::encodeInstructionBits(Instruction &inst) {
+  encodeInstruction(inst);
+  if (hasFatalError()) {
+    return false;
+  }
+  setEncodedPC(&inst, currentPc());
+
+  bool mustCompact, tryCompact;
+  getCompaction(inst, mustCompact, tryCompact);
+
+  MInst native, compact;
+  GED_RETURN_VALUE compactStatus = GED_RETURN_VALUE_SIZE;
+  if (tryCompact && !m_opts.memoizeCompaction) {
+    // try compact first; the native encoding is only needed if that fails
+    compactStatus = GED_EncodeIns(&m_gedInst, GED_INS_TYPE_COMPACT,
+                                  (unsigned char *)&compact);
+  }
+  if (compactStatus != GED_RETURN_VALUE_SUCCESS) {
+    GED_RETURN_VALUE status = GED_EncodeIns(&m_gedInst, GED_INS_TYPE_NATIVE,
+                                            (unsigned char *)&native);
     if (status != GED_RETURN_VALUE_SUCCESS) {
-      inst->removeInstOpt(InstOpt::COMPACTED);
-      status = GED_EncodeIns(&m_gedInst, GED_INS_TYPE_NATIVE,
-                             m_instBuf + currentPc());
-      if (status != GED_RETURN_VALUE_SUCCESS) {
-        errorAtT(inst->getLoc(), "GED unable to encode instruction: ",
-                 gedReturnValueToString(status));
+      inst.removeInstOpt(InstOpt::COMPACTED);
+      errorAtT(inst.getLoc(), "GED unable to encode instruction: ",
+               gedReturnValueToString(status));
+      advancePc(UNCOMPACTED_SIZE);
+      return true;
+    }
+    if (tryCompact && m_opts.memoizeCompaction) {
+      const GEDCompaction &c = compactNative(native);
+      compactStatus = c.status;
+      compact = c.compact;
+    }
+  }
+
+  const MInst *bits = &native;
+  int32_t iLen = UNCOMPACTED_SIZE;
+  if (compactStatus == GED_RETURN_VALUE_SUCCESS) {
+    // If auto compation is turned on, in case we need to patch later.
+    inst.addInstOpt(InstOpt::COMPACTED);
+    bits = &compact;
+    iLen = COMPACTED_SIZE;
+  } else if (compactStatus == GED_RETURN_VALUE_NO_COMPACT_FORM) {
+    if (mustCompact) {
+      if (m_opts.explicitCompactMissIsWarning) {
+        warningAtT(inst.getLoc(), "GED unable to compact instruction");
+      } else {
+        errorAtT(inst.getLoc(), "GED unable to compact instruction");
       }
     }
+  } // else: not tried or some other error (unreachable?)
+  if (iLen == UNCOMPACTED_SIZE) {
+    inst.removeInstOpt(InstOpt::COMPACTED);
+  }
+  memcpy_s(m_instBuf + currentPc(), iLen, bits, iLen);
+  advancePc(iLen);
+  return true;
+}
+
+const Encoder::GEDCompaction &Encoder::compactNative(const MInst &native) {
+  if (m_opts.stats) {
+    m_opts.stats->compactionCacheLookups++;
+  }
+  auto itr = m_compactions.find(native);
+  if (itr != m_compactions.end()) {
+    if (m_opts.stats) {
+      m_opts.stats->compactionCacheHits++;
+    }
+    return itr->second;
+  }
+  // m_gedInst still holds the instruction native was encoded from
+  GEDCompaction &c = m_compactions[native];
+  c.status = GED_EncodeIns(&m_gedInst, GED_INS_TYPE_COMPACT,
+                           (unsigned char *)&c.compact);
+  return c;
+}
+
+bool Encoder::isTemplateCandidate(const Instruction &inst) const {
+  // only the platforms IGAExe/tests/fast_encode.cmake checks against GED;
+  // branches and label movs are patched later (patchJumpOffsets)
+  return platform() >= Platform::XE && platform() <= Platform::XE_HPC &&
+         inst.getOp() != Op::ILLEGAL && !inst.isBranching() &&
+         !inst.isMovWithLabel();
+}
+
+bool Encoder::encodeInstructionBitsFast(Instruction &inst) {
+  bool mustCompact, tryCompact;
+  getCompaction(inst, mustCompact, tryCompact);
+  EncodingTemplate &t = m_templates[EncodingKey(inst)];
+  const TemplateSlotValues tsv(inst, m_opts.swsbEncodeMode);
+
+  // a {Compacted} instruction without a compact form goes through GED
+  // for the diagnostic
+  const bool compacted = tryCompact && t.compactable;
+  MInst bits;
+  const bool hit =
+      t.state == EncodingTemplate::State::READY &&
+      (!tryCompact || t.compactionProbed) && (!mustCompact || compacted) &&
+      t.instantiate(tsv, compacted, bits);
+  if (m_opts.stats) {
+    m_opts.stats->templateLookups++;
+    m_opts.stats->templateHits += hit;
+  }
+  if (hit) {
+    const int32_t iLen = compacted ? COMPACTED_SIZE : UNCOMPACTED_SIZE;
+    if (m_opts.verifyFastEncode) {
+      const int32_t pc = currentPc();
+      if (!encodeInstructionBits(inst)) {
+        return false;
+      }
+      if (currentPc() - pc != iLen ||
+          memcmp(m_instBuf + pc, &bits, iLen) != 0) {
+        errorAtT(inst.getLoc(),
+                 "fast path encoding differs from the GED encoding");
+      }
+      return true;
+    }
+    setEncodedPC(&inst, currentPc());
+    memcpy_s(m_instBuf + currentPc(), iLen, &bits, iLen);
+    if (compacted) {
+      inst.addInstOpt(InstOpt::COMPACTED);
+    } else {
+      inst.removeInstOpt(InstOpt::COMPACTED);
+    }
     advancePc(iLen);
+    return true;
+  }
+
+  const ErrorHandler &eh = errorHandler();
+  const size_t diagnostics = eh.getErrors().size() + eh.getWarnings().size();
+  const int32_t pc = currentPc();
+  if (!encodeInstructionBits(inst)) {
+    return false;
+  }
+  // a form gets a template on its second diagnostic free occurrence
+  if (t.state == EncodingTemplate::State::NEW) {
+    t.state = EncodingTemplate::State::SEEN;
+  } else if (t.state == EncodingTemplate::State::SEEN &&
+             diagnostics == eh.getErrors().size() + eh.getWarnings().size()) {
+    buildTemplate(t, inst, tsv, tryCompact, pc);
+  }
+  return true;
+}
+
+static void setTemplateSlotRegs(Instruction &inst,
+                                const TemplateSlotValues &tsv,
+                                const uint32_t *values) {
+  if (tsv.present[(int)TemplateSlot::DST]) {
+    Operand &dst = inst.getDestination();
+    dst.setRegRef(RegRef((uint16_t)values[(int)TemplateSlot::DST],
+                         dst.getDirRegRef().subRegNum));
+  }
+  for (int i = 0; i < 3; i++) {
+    const int s = (int)TemplateSlot::SRC0 + i;
+    if (tsv.present[s]) {
+      Operand &src = inst.getSource(i);
+      src.setRegRef(RegRef((uint16_t)values[s], src.getDirRegRef().subRegNum));
+    }
+  }
+}
+
+bool Encoder::encodeProbe(Instruction &inst, const TemplateSlotValues &tsv,
+                          const uint32_t *values, bool tryCompact,
+                          MInst &native, MInst &compact, bool &compacted) {
+  setTemplateSlotRegs(inst, tsv, values);
+#ifndef IGA_DISABLE_ENCODER_EXCEPTIONS
+  try {
+#endif
+    setCurrInst(&inst);
+    encodeInstruction(inst);
+#ifndef IGA_DISABLE_ENCODER_EXCEPTIONS
+  } catch (const iga::FatalError &) {
+    return false;
+  }
+#endif
+  if (errorHandler().hasDiagnostics() ||
+      GED_SetSWSB(&m_gedInst, values[(int)TemplateSlot::SWSB]) !=
+          GED_RETURN_VALUE_SUCCESS) {
+    return false;
+  }
+
+  native = MInst();
+  compact = MInst();
+  compacted = tryCompact &&
+              GED_EncodeIns(&m_gedInst, GED_INS_TYPE_COMPACT,
+                            (unsigned char *)&compact) ==
+                  GED_RETURN_VALUE_SUCCESS;
+  return GED_EncodeIns(&m_gedInst, GED_INS_TYPE_NATIVE,
+                       (unsigned char *)&native) == GED_RETURN_VALUE_SUCCESS;
+}
+
+// Derives the template for inst's form from GED.  Each probe re-encodes inst
+// (with a scratch encoder so probe values never surface as diagnostics)
+// with chosen values in the slots being located; LocateTemplateSlots
+// explains the probes.  Slots that can't be located are pinned to inst's
+// values and the probes are repeated without them.
+void Encoder::buildTemplate(EncodingTemplate &t, Instruction &inst,
+                            const TemplateSlotValues &tsv, bool tryCompact,
+                            int32_t pc) {
+  t.state = EncodingTemplate::State::UNUSABLE;
+  const bool instCompacted = inst.hasInstOpt(InstOpt::COMPACTED);
+
+  // GRF numbers are probed up to the largest all-ones register number
+  int widths[TEMPLATE_SLOTS] = {};
+  int grfWidth = 0;
+  const RegInfo *grf = m_model.lookupRegInfoByRegName(RegName::GRF_R);
+  while (grf && grfWidth < 16 &&
+         grf->isRegNumberValid((2 << grfWidth) - 1)) {
+    grfWidth++;
+  }
+  unsigned active = 0;
+  for (int s = (int)TemplateSlot::DST; s <= (int)TemplateSlot::SRC2; s++) {
+    if (tsv.present[s] && grfWidth > 0) {
+      widths[s] = grfWidth;
+      active |= 1u << s;
+    }
+  }
+  // m_gedInst still holds inst
+  const int swsbWidth = (int)GED_FieldSize(&m_gedInst, GED_INS_FIELD_SWSB);
+  if (swsbWidth > 0 && swsbWidth <= 16) {
+    widths[(int)TemplateSlot::SWSB] = swsbWidth;
+    active |= 1u << (int)TemplateSlot::SWSB;
+  }
+
+  enum { BASE, ONES, PATTERNS, TAGS = PATTERNS + TEMPLATE_MAX_PATTERNS,
+         PROBES = TAGS + TEMPLATE_TAG_PROBES };
+  MInst natives[PROBES], compacts[PROBES];
+  int nativeOffsets[TEMPLATE_SLOTS] = {}, compactOffsets[TEMPLATE_SLOTS] = {};
+  bool located = false;
+  for (int round = 0; round < 3 && !located; round++) {
+    int maxWidth = 0;
+    for (int s = 0; s < TEMPLATE_SLOTS; s++) {
+      if (active & (1u << s))
+        maxWidth = std::max(maxWidth, widths[s]);
+    }
+    int numPatterns = 0;
+    while ((1 << numPatterns) < maxWidth)
+      numPatterns++;
+
+    ErrorHandler probeErrors;
+    Encoder probe(m_model, probeErrors, m_opts);
+    bool probed = true;
+    for (int p = 0; p < PROBES && probed; p++) {
+      if (p >= PATTERNS + numPatterns && p < TAGS)
+        continue;
+      uint32_t values[TEMPLATE_SLOTS];
+      for (int s = 0; s < TEMPLATE_SLOTS; s++) {
+        const uint32_t ones = (1u << widths[s]) - 1;
+        if (!(active & (1u << s))) {
+          values[s] = tsv.values[s]; // pinned
+        } else if (p == BASE) {
+          values[s] = 0;
+        } else if (p == ONES) {
+          values[s] = ones;
+        } else if (p < TAGS) {
+          values[s] = 0;
+          for (int i = 0; i < widths[s]; i++)
+            if ((i >> (p - PATTERNS)) & 1)
+              values[s] |= 1u << i;
+        } else {
+          values[s] = ((s >> (p - TAGS)) & 1) ? ones : 0;
+        }
+      }
+      bool compacted = false;
+      probed = probe.encodeProbe(inst, tsv, values, tryCompact, natives[p],
+                                 compacts[p], compacted) &&
+               compacted == instCompacted;
+    }
+    if (!probed) {
+      // the probes changed the encoding beyond the slots (or failed);
+      // all that's left is to pin every slot
+      if (active == 0)
+        break;
+      active = 0;
+      continue;
+    }
+
+    unsigned badSlots =
+        LocateTemplateSlots(natives[BASE], natives[ONES], natives + PATTERNS,
+                            numPatterns, natives + TAGS, widths, active,
+                            nativeOffsets);
+    if (instCompacted) {
+      badSlots |= LocateTemplateSlots(
+          compacts[BASE], compacts[ONES], compacts + PATTERNS, numPatterns,
+          compacts + TAGS, widths, active, compactOffsets);
+    }
+    if (badSlots) {
+      active &= ~badSlots;
+    } else {
+      located = true;
+    }
+  }
+
+  setTemplateSlotRegs(inst, tsv, tsv.values);
+  if (!located) {
+    return;
+  }
+
+  t.native = natives[BASE];
+  t.compact = compacts[BASE];
+  t.compactionProbed = tryCompact;
+  t.compactable = instCompacted;
+  for (int s = 0; s < TEMPLATE_SLOTS; s++) {
+    EncodingTemplate::Slot &slot = t.slots[s];
+    slot.width = (active & (1u << s)) ? widths[s] : 0;
+    slot.pinned = tsv.values[s];
+    slot.nativeOffset = nativeOffsets[s];
+    slot.compactOffset = compactOffsets[s];
+  }
+
+  // the template must reproduce the instruction it came from
+  MInst predicted, actual;
+  const int32_t iLen = instCompacted ? COMPACTED_SIZE : UNCOMPACTED_SIZE;
+  memcpy_s(&actual, iLen, m_instBuf + pc, iLen);
+  if (t.instantiate(tsv, instCompacted, predicted) && predicted == actual) {
+    t.state = EncodingTemplate::State::READY;
   }
 }
 
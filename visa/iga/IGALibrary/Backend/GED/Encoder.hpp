@@ -15,11 +15,13 @@ SPDX-License-Identifier: MIT
 #include "../../IR/Kernel.hpp"
 #include "../../Timer/Timer.hpp"
 #include "../EncoderOpts.hpp"
+#include "EncodingTemplates.hpp"
 #include "GEDBitProcessor.hpp"
 #include "IGAToGEDTranslation.hpp"
 
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace iga {
@@ -151,6 +153,38 @@ private:
 
   void encodeBlock(Kernel &k, Block *blk);
   void encodeInstruction(Instruction &inst);
+  // encodes inst at the current PC and advances the PC;
+  // these return false on a fatal error
+  bool encodeInstructionBits(Instruction &inst);
+  bool encodeInstructionBitsFast(Instruction &inst);
+  // GED's compaction searches the compaction tables on every call, but its
+  // result only depends on the native encoding, which repeats heavily
+  // within a kernel; so the results can be memoized per native encoding
+  // (EncoderOpts::memoizeCompaction)
+  struct GEDCompaction {
+    GED_RETURN_VALUE status = GED_RETURN_VALUE_SIZE;
+    MInst compact;
+  };
+  struct MInstHash {
+    size_t operator()(const MInst &mi) const {
+      return std::hash<uint64_t>()(mi.qw0 ^ (mi.qw1 * 0x9E3779B97F4A7C15ull));
+    }
+  };
+  // compacts the instruction m_gedInst was just encoded to native from
+  const GEDCompaction &compactNative(const MInst &native);
+  void getCompaction(const Instruction &inst, bool &mustCompact,
+                     bool &tryCompact) const;
+
+  ///////////////////////////////////////////////////////////////////////
+  // FAST PATH (EncoderOpts::fastEncode)
+  ///////////////////////////////////////////////////////////////////////
+  bool isTemplateCandidate(const Instruction &inst) const;
+  void buildTemplate(EncodingTemplate &t, Instruction &inst,
+                     const TemplateSlotValues &tsv, bool tryCompact,
+                     int32_t pc);
+  bool encodeProbe(Instruction &inst, const TemplateSlotValues &tsv,
+                   const uint32_t *values, bool tryCompact, MInst &native,
+                   MInst &compact, bool &compacted);
   void patchJumpOffsets();
 
   ///////////////////////////////////////////////////////////////////////
@@ -237,6 +271,9 @@ private:
   };
   std::vector<JumpPatch> m_needToPatch;
   std::map<const Block *, int32_t> m_blockToOffsetMap;
+  std::unordered_map<EncodingKey, EncodingTemplate, EncodingKeyHash>
+      m_templates;
+  std::unordered_map<MInst, GEDCompaction, MInstHash> m_compactions;
 
 public:
   ////////////////////////////////////////////////////////////////
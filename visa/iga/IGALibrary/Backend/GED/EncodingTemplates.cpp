@@ -0,0 +1,180 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#include "EncodingTemplates.hpp"
+
+#include <cstring>
+
+using namespace iga;
+
+static bool isGRFSlot(const Operand &op) {
+  return op.getKind() == Operand::Kind::DIRECT &&
+         op.getDirRegName() == RegName::GRF_R;
+}
+
+static bool hasDstSlot(const Instruction &inst) {
+  return inst.getOpSpec().supportsDestination() &&
+         isGRFSlot(inst.getDestination());
+}
+
+static void appendOperand(uint64_t *&w, const Operand &op, bool isSlot) {
+  const Region rgn = op.getRegion();
+  const uint64_t rgnBits = (uint64_t)rgn.v | ((uint64_t)rgn.w << 6) |
+                           ((uint64_t)rgn.h << 11);
+  *w++ = (uint64_t)op.getKind() | ((uint64_t)op.getDirRegName() << 8) |
+         ((uint64_t)op.getType() << 16) |
+         ((uint64_t)op.getSrcModifier() << 24) |
+         ((uint64_t)op.getMathMacroExt() << 32) | (rgnBits << 40);
+  // the direct and indirect register share the RegRef
+  const RegRef &rr = op.getDirRegRef();
+  *w++ = (isSlot ? 0 : (uint64_t)rr.regNum) | ((uint64_t)rr.subRegNum << 16) |
+         ((uint64_t)(uint16_t)op.getIndImmAddr() << 32);
+  // the encoder converts by operand type, which is already in the key
+  *w++ = op.getKind() == Operand::Kind::IMMEDIATE
+             ? op.getImmediateValue().u64
+             : 0;
+}
+
+EncodingKey::EncodingKey(const Instruction &inst) {
+  uint64_t *w = words;
+  const Predication &pred = inst.getPredication();
+  *w++ = (uint64_t)inst.getOp() | ((uint64_t)inst.getMaskCtrl() << 16) |
+         ((uint64_t)inst.getExecSize() << 24) |
+         ((uint64_t)inst.getChannelOffset() << 32) |
+         ((uint64_t)inst.getFlagModifier() << 40) |
+         ((uint64_t)pred.function << 48) | ((uint64_t)pred.inverse << 56);
+  const RegRef &fr = inst.getFlagReg();
+  *w++ = inst.getSubfunction().bits | ((uint64_t)fr.regNum << 32) |
+         ((uint64_t)fr.subRegNum << 48);
+  const SendDesc exDesc = inst.getExtMsgDescriptor();
+  const SendDesc desc = inst.getMsgDescriptor();
+  *w++ = (uint64_t)exDesc.type << 32 | exDesc.imm;
+  *w++ = (uint64_t)desc.type << 32 | desc.imm;
+  *w++ = (uint64_t)(uint16_t)inst.getDstLength() |
+         ((uint64_t)(uint16_t)inst.getSrc0Length() << 16) |
+         ((uint64_t)(uint16_t)inst.getSrc1Length() << 32);
+  *w++ = (uint64_t)inst.getInstOpts().bits;
+
+  appendOperand(w, inst.getDestination(), hasDstSlot(inst));
+  for (int i = 0; i < 3; i++) {
+    const Operand &src = inst.getSource(i);
+    appendOperand(w, src, i < (int)inst.getSourceCount() && isGRFSlot(src));
+  }
+  IGA_ASSERT(w == words + WORDS, "EncodingKey: word count mismatch");
+}
+
+bool EncodingKey::operator==(const EncodingKey &rhs) const {
+  return memcmp(words, rhs.words, sizeof(words)) == 0;
+}
+
+size_t EncodingKeyHash::operator()(const EncodingKey &key) const {
+  uint64_t h = 0;
+  for (uint64_t w : key.words) {
+    h ^= w + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+  }
+  return (size_t)h;
+}
+
+TemplateSlotValues::TemplateSlotValues(const Instruction &inst,
+                                       SWSB_ENCODE_MODE swsbMode) {
+  present[(int)TemplateSlot::DST] = hasDstSlot(inst);
+  values[(int)TemplateSlot::DST] =
+      inst.getDestination().getDirRegRef().regNum;
+  for (int i = 0; i < 3; i++) {
+    const Operand &src = inst.getSource(i);
+    const int s = (int)TemplateSlot::SRC0 + i;
+    present[s] = i < (int)inst.getSourceCount() && isGRFSlot(src);
+    values[s] = src.getDirRegRef().regNum;
+  }
+  present[(int)TemplateSlot::SWSB] = true;
+  values[(int)TemplateSlot::SWSB] =
+      inst.getSWSB().encode(swsbMode, inst.getSWSBInstType(swsbMode));
+}
+
+bool EncodingTemplate::instantiate(const TemplateSlotValues &tsv,
+                                   bool compacted, MInst &bits) const {
+  bits = compacted ? compact : native;
+  for (int s = 0; s < TEMPLATE_SLOTS; s++) {
+    if (!tsv.present[s]) {
+      continue;
+    }
+    const Slot &slot = slots[s];
+    if (slot.width == 0) {
+      if (tsv.values[s] != slot.pinned)
+        return false;
+    } else if (!bits.setBits(compacted ? slot.compactOffset
+                                       : slot.nativeOffset,
+                             slot.width, tsv.values[s])) {
+      return false; // too large for the field
+    }
+  }
+  return true;
+}
+
+static MInst xorBits(const MInst &a, const MInst &b) {
+  MInst x;
+  x.qw0 = a.qw0 ^ b.qw0;
+  x.qw1 = a.qw1 ^ b.qw1;
+  return x;
+}
+
+unsigned iga::LocateTemplateSlots(const MInst &base, const MInst &ones,
+                                  const MInst *patterns, int numPatterns,
+                                  const MInst *tags, const int *widths,
+                                  unsigned activeSlots, int *offsets) {
+  const MInst changed = xorBits(ones, base);
+  MInst patternDiffs[TEMPLATE_MAX_PATTERNS], tagDiffs[TEMPLATE_TAG_PROBES];
+  for (int j = 0; j < numPatterns; j++) {
+    patternDiffs[j] = xorBits(patterns[j], base);
+    // no probe may touch bits outside the slots
+    if ((patternDiffs[j].qw0 & ~changed.qw0) ||
+        (patternDiffs[j].qw1 & ~changed.qw1))
+      return activeSlots;
+  }
+  for (int k = 0; k < TEMPLATE_TAG_PROBES; k++) {
+    tagDiffs[k] = xorBits(tags[k], base);
+    if ((tagDiffs[k].qw0 & ~changed.qw0) || (tagDiffs[k].qw1 & ~changed.qw1))
+      return activeSlots;
+  }
+
+  // positions[s][i] is where bit i of slot s landed
+  int positions[TEMPLATE_SLOTS][1 << TEMPLATE_MAX_PATTERNS];
+  for (auto &ps : positions)
+    for (int &p : ps)
+      p = -1;
+
+  unsigned badSlots = 0;
+  for (int b = 0; b < 128; b++) {
+    if (!changed.testBit(b))
+      continue;
+    int s = 0, i = 0;
+    for (int k = 0; k < TEMPLATE_TAG_PROBES; k++)
+      s |= (int)tagDiffs[k].testBit(b) << k;
+    for (int j = 0; j < numPatterns; j++)
+      i |= (int)patternDiffs[j].testBit(b) << j;
+    if (s >= TEMPLATE_SLOTS || !(activeSlots & (1u << s)) || i >= widths[s])
+      return activeSlots; // can't tell whose bit this is
+    if (positions[s][i] >= 0)
+      badSlots |= 1u << s; // the value lands in more than one place
+    positions[s][i] = b;
+  }
+
+  for (int s = 0; s < TEMPLATE_SLOTS; s++) {
+    if (!(activeSlots & (1u << s)) || (badSlots & (1u << s)))
+      continue;
+    const int off = positions[s][0];
+    bool contiguous = off >= 0 && off / 64 == (off + widths[s] - 1) / 64;
+    for (int i = 0; contiguous && i < widths[s]; i++)
+      contiguous = positions[s][i] == off + i;
+    if (contiguous)
+      offsets[s] = off;
+    else
+      badSlots |= 1u << s;
+  }
+  return badSlots;
+}
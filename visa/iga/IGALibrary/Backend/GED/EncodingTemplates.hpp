@@ -0,0 +1,107 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#ifndef _IGA_BACKEND_GED_ENCODINGTEMPLATES_HPP_
+#define _IGA_BACKEND_GED_ENCODINGTEMPLATES_HPP_
+
+#include "../../IR/Instruction.hpp"
+#include "../Native/MInst.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Encoding templates back the encoder's fast path (EncoderOpts::fastEncode).
+//
+// Generated code repeats a small number of instruction forms that differ
+// only in their GRF numbers and SWSB annotations.  A template caches the
+// native and compacted encodings of one such form with those fields zeroed
+// together with where each of them lands in the bits; later instructions of
+// the same form are encoded by copying the bits and patching the fields in.
+//
+// The layouts are not tabulated per platform; the encoder derives them from
+// GED by encoding a few probe instructions with chosen field values (see
+// Encoder::buildTemplate and LocateTemplateSlots).  Anything that can't be
+// derived that way falls back to GED.
+namespace iga {
+// the fields a template patches
+enum class TemplateSlot { DST, SRC0, SRC1, SRC2, SWSB };
+static const int TEMPLATE_SLOTS = 5;
+// enough pattern probes for slots up to 16 bits wide
+static const int TEMPLATE_MAX_PATTERNS = 4;
+// enough tag probes to tell TEMPLATE_SLOTS slots apart
+static const int TEMPLATE_TAG_PROBES = 3;
+
+// Everything the GED encoder reads from an instruction other than the
+// template slot values.  Instructions with equal keys encode identically
+// up to the slots.
+struct EncodingKey {
+  static const int WORDS = 18;
+  uint64_t words[WORDS];
+
+  explicit EncodingKey(const Instruction &inst);
+  bool operator==(const EncodingKey &rhs) const;
+};
+struct EncodingKeyHash {
+  size_t operator()(const EncodingKey &key) const;
+};
+
+// the current values of an instruction's template slots
+struct TemplateSlotValues {
+  bool present[TEMPLATE_SLOTS];
+  uint32_t values[TEMPLATE_SLOTS];
+
+  TemplateSlotValues(const Instruction &inst, SWSB_ENCODE_MODE swsbMode);
+};
+
+struct EncodingTemplate {
+  enum class State {
+    NEW,      // first occurrence
+    SEEN,     // built after the next GED encoding that is diagnostic free
+    READY,    // usable
+    UNUSABLE, // probing failed; always encode with GED
+  };
+  State state = State::NEW;
+
+  struct Slot {
+    // the number of patched bits; 0 means the template only applies
+    // to instructions that have 'pinned' in this slot
+    int width = 0;
+    uint32_t pinned = 0;
+    int nativeOffset = 0;
+    int compactOffset = 0;
+  };
+  Slot slots[TEMPLATE_SLOTS];
+
+  MInst native;
+  MInst compact;
+  // compaction was attempted for the probes
+  bool compactionProbed = false;
+  // the form has a compacted encoding
+  bool compactable = false;
+
+  // Forms the encoding of an instruction with the given slot values.
+  // Returns false if some value can't be patched in (the caller uses GED).
+  bool instantiate(const TemplateSlotValues &tsv, bool compacted,
+                   MInst &bits) const;
+};
+
+// Given the encodings of the probes of one template (in one form) finds the
+// offset of each active slot.  Relative to 'base' (all active slots zero):
+//  - 'ones' sets every active slot to all ones
+//  - 'patterns[j]' sets bit i of every active slot iff bit j of i is set
+//  - 'tags[k]' sets every active slot s to all ones iff bit k of s is set
+// so each flipped bit identifies its slot and its position within the slot.
+// A slot is usable if its bits appear as a contiguous, in order copy of the
+// value within one qword.  Returns the mask of active slots that aren't.
+unsigned LocateTemplateSlots(const MInst &base, const MInst &ones,
+                             const MInst *patterns, int numPatterns,
+                             const MInst *tags, const int *widths,
+                             unsigned activeSlots, int *offsets);
+} // namespace iga
+
+#endif // _IGA_BACKEND_GED_ENCODINGTEMPLATES_HPP_
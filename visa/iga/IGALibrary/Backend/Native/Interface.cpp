@@ -125,11 +125,15 @@ static size_t encodeInst(InstEncoder &enc, const EncoderOpts &opts,
     }
   } // not trying to compact
 
-  if (bits->isCompact()) {
-    return 8;
-  } else {
-    return 16;
+  size_t iLen = bits->isCompact() ? 8 : 16;
+  if (opts.stats) {
+    opts.stats->instructions++;
+    opts.stats->bytes += iLen;
+    opts.stats->compactionAttempts +=
+        mustCompact || (opts.autoCompact && !mustntCompact);
+    opts.stats->compacted += bits->isCompact();
   }
+  return iLen;
 }
 
 struct SerialEncoder : BitProcessor {
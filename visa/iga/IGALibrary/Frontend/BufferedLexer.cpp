@@ -0,0 +1,322 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#include "BufferedLexer.hpp"
+
+using namespace iga;
+
+// The lexical grammar of GEN assembly.
+//
+//   IDENT     [_a-zA-Z][_a-zA-Z0-9]*
+//             [1-9][0-9]*x[0-9]+        e.g. 128x16
+//   INTLIT10  [0-9]+
+//   INTLIT16  0[xX][0-9A-Fa-f]+
+//   INTLIT02  0[bB][01]+
+//   FLTLIT    [0-9]+\.[0-9]+            (no .5 since that breaks f0.0)
+//             [0-9]+(\.[0-9]+)?[eE][-+]?[0-9]+
+//             0[xX]{HEX_FRAC or HEX_DIGITS}[pP][-+]?[0-9]+
+//   NEWLINE   \n (newlines are explicitly represented)
+//
+// The operators and delimiters are the ones listed in Lexemes.hpp plus
+// "(abs)" and "(sat)".  Blanks ([ \t\r]), // comments and /* */ comments
+// are skipped.  The longest match wins, so 0x13 is one INTLIT16 and
+// 128x16 one IDENT; any other character is a one character LEXICAL_ERROR.
+// An unterminated /* comment extends to the end of the input.
+
+static inline char CharAt(std::string_view s, size_t i) {
+  return i < s.size() ? s[i] : 0;
+}
+
+static inline bool IsBinDigit(char c) { return c == '0' || c == '1'; }
+static inline bool IsDecDigit(char c) { return c >= '0' && c <= '9'; }
+static inline bool IsHexDigit(char c) {
+  return IsDecDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+static inline bool IsIdentStart(char c) {
+  return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+static inline bool IsIdentChar(char c) {
+  return IsIdentStart(c) || IsDecDigit(c);
+}
+
+static size_t ScanDigits(std::string_view s, size_t i, bool (*isDigit)(char)) {
+  size_t k = i;
+  while (isDigit(CharAt(s, k)))
+    k++;
+  return k - i;
+}
+
+// matches [eE][-+]?[0-9]+ (or the [pP] form) at i; returns 0 on mismatch
+static size_t ScanExponent(std::string_view s, size_t i, char lower,
+                           char upper) {
+  if (CharAt(s, i) != lower && CharAt(s, i) != upper)
+    return 0;
+  size_t k = i + 1;
+  if (CharAt(s, k) == '-' || CharAt(s, k) == '+')
+    k++;
+  size_t digits = ScanDigits(s, k, IsDecDigit);
+  return digits == 0 ? 0 : k + digits - i;
+}
+
+// s starts with a decimal digit; returns the longest numeric match
+static Lexeme ScanNumber(std::string_view s, size_t &len) {
+  const size_t dec = ScanDigits(s, 0, IsDecDigit);
+  Lexeme lxm = Lexeme::INTLIT10;
+  len = dec;
+  auto longer = [&](Lexeme l, size_t n) {
+    if (n > len) {
+      lxm = l;
+      len = n;
+    }
+  };
+
+  if (s[0] == '0' && (CharAt(s, 1) == 'x' || CharAt(s, 1) == 'X')) {
+    size_t hex = ScanDigits(s, 2, IsHexDigit);
+    if (hex > 0)
+      longer(Lexeme::INTLIT16, 2 + hex);
+    // 0x1.8p3, 0x.8p3, 0x1.p3, 0x1p3
+    size_t k = 2 + hex, frac = 0;
+    if (CharAt(s, k) == '.') {
+      frac = ScanDigits(s, k + 1, IsHexDigit);
+      k += 1 + frac;
+    }
+    size_t exp = hex + frac > 0 ? ScanExponent(s, k, 'p', 'P') : 0;
+    if (exp > 0)
+      longer(Lexeme::FLTLIT, k + exp);
+    return lxm;
+  } else if (s[0] == '0' && (CharAt(s, 1) == 'b' || CharAt(s, 1) == 'B')) {
+    size_t bin = ScanDigits(s, 2, IsBinDigit);
+    if (bin > 0)
+      longer(Lexeme::INTLIT02, 2 + bin);
+    return lxm;
+  }
+
+  // 3.14, 3e-9, 3.14e9
+  size_t k = dec;
+  if (CharAt(s, k) == '.') {
+    size_t frac = ScanDigits(s, k + 1, IsDecDigit);
+    if (frac > 0) {
+      k += 1 + frac;
+      longer(Lexeme::FLTLIT, k);
+    }
+  }
+  size_t exp = ScanExponent(s, k, 'e', 'E');
+  if (exp > 0)
+    longer(Lexeme::FLTLIT, k + exp);
+
+  // 128x16
+  if (s[0] != '0' && CharAt(s, dec) == 'x') {
+    size_t dim = ScanDigits(s, dec + 1, IsDecDigit);
+    if (dim > 0)
+      longer(Lexeme::IDENT, dec + 1 + dim);
+  }
+  return lxm;
+}
+
+static uint32_t HashSymbol(std::string_view name) {
+  // FNV-1a; identifiers are short
+  uint32_t h = 2166136261u;
+  for (char c : name) {
+    h ^= (uint8_t)c;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+void SymbolTable::Grow() {
+  std::vector<uint32_t> slots(m_slots.empty() ? 256 : 2 * m_slots.size(), 0);
+  const size_t mask = slots.size() - 1;
+  for (uint32_t sym = 0; sym < (uint32_t)m_names.size(); sym++) {
+    size_t i = m_hashes[sym] & mask;
+    while (slots[i] != 0)
+      i = (i + 1) & mask;
+    slots[i] = sym + 1;
+  }
+  m_slots.swap(slots);
+}
+
+uint32_t SymbolTable::intern(std::string_view name) {
+  if (2 * (m_names.size() + 1) > m_slots.size())
+    Grow();
+  const uint32_t h = HashSymbol(name);
+  const size_t mask = m_slots.size() - 1;
+  for (size_t i = h & mask;; i = (i + 1) & mask) {
+    uint32_t slot = m_slots[i];
+    if (slot == 0) {
+      m_names.push_back(name);
+      m_hashes.push_back(h);
+      m_slots[i] = (uint32_t)m_names.size();
+      return (uint32_t)m_names.size() - 1;
+    } else if (m_hashes[slot - 1] == h && m_names[slot - 1] == name) {
+      return slot - 1;
+    }
+  }
+}
+
+void BufferedLexer::Tokenize() {
+  const char *inp = m_input.data();
+  const size_t inpLen = m_input.size();
+  // most tokens are a few characters; this avoids most regrowth
+  m_tokens.reserve(inpLen / 4 + 1);
+
+  size_t off = 0, bolOff = 0; // bolOff is the start of the current line
+  uint32_t lno = 1;
+  while (off < inpLen) {
+    const std::string_view rest(inp + off, inpLen - off);
+    Lexeme lxm = Lexeme::LEXICAL_ERROR;
+    size_t len = 1;
+    switch (rest[0]) {
+    case ' ':
+    case '\t':
+    case '\r':
+      off++;
+      continue;
+    case '\n':
+      m_tokens.emplace_back(Lexeme::NEWLINE, lno, (uint32_t)(off - bolOff + 1),
+                            (uint32_t)off, 1);
+      off++;
+      lno++;
+      bolOff = off;
+      continue;
+    case '/':
+      if (CharAt(rest, 1) == '/') {
+        while (off < inpLen && inp[off] != '\n')
+          off++;
+        continue;
+      } else if (CharAt(rest, 1) == '*') {
+        off += 2;
+        while (off < inpLen &&
+               !(inp[off] == '*' && off + 1 < inpLen && inp[off + 1] == '/')) {
+          if (inp[off] == '\n') {
+            lno++;
+            bolOff = off + 1;
+          }
+          off++;
+        }
+        off = off < inpLen ? off + 2 : inpLen;
+        continue;
+      }
+      lxm = Lexeme::DIV;
+      break;
+    case '(':
+      if (rest.substr(0, 5) == "(abs)") {
+        lxm = Lexeme::ABS;
+        len = 5;
+      } else if (rest.substr(0, 5) == "(sat)") {
+        lxm = Lexeme::SAT;
+        len = 5;
+      } else {
+        lxm = Lexeme::LPAREN;
+      }
+      break;
+    case '<':
+      if (CharAt(rest, 1) == '<') {
+        lxm = Lexeme::LSH;
+        len = 2;
+      } else {
+        lxm = Lexeme::LANGLE;
+      }
+      break;
+    case '>':
+      if (CharAt(rest, 1) == '>') {
+        lxm = Lexeme::RSH;
+        len = 2;
+      } else {
+        lxm = Lexeme::RANGLE;
+      }
+      break;
+    case '[':
+      lxm = Lexeme::LBRACK;
+      break;
+    case ']':
+      lxm = Lexeme::RBRACK;
+      break;
+    case '{':
+      lxm = Lexeme::LBRACE;
+      break;
+    case '}':
+      lxm = Lexeme::RBRACE;
+      break;
+    case ')':
+      lxm = Lexeme::RPAREN;
+      break;
+    case '$':
+      lxm = Lexeme::DOLLAR;
+      break;
+    case '.':
+      lxm = Lexeme::DOT;
+      break;
+    case ',':
+      lxm = Lexeme::COMMA;
+      break;
+    case ';':
+      lxm = Lexeme::SEMI;
+      break;
+    case ':':
+      lxm = Lexeme::COLON;
+      break;
+    case '~':
+      lxm = Lexeme::TILDE;
+      break;
+    case '!':
+      lxm = Lexeme::BANG;
+      break;
+    case '@':
+      lxm = Lexeme::AT;
+      break;
+    case '#':
+      lxm = Lexeme::HASH;
+      break;
+    case '=':
+      lxm = Lexeme::EQ;
+      break;
+    case '%':
+      lxm = Lexeme::MOD;
+      break;
+    case '*':
+      lxm = Lexeme::MUL;
+      break;
+    case '+':
+      lxm = Lexeme::ADD;
+      break;
+    case '-':
+      lxm = Lexeme::SUB;
+      break;
+    case '&':
+      lxm = Lexeme::AMP;
+      break;
+    case '^':
+      lxm = Lexeme::CIRC;
+      break;
+    case '|':
+      lxm = Lexeme::PIPE;
+      break;
+    default:
+      if (IsDecDigit(rest[0])) {
+        lxm = ScanNumber(rest, len);
+      } else if (IsIdentStart(rest[0])) {
+        while (len < rest.size() && IsIdentChar(rest[len]))
+          len++;
+        lxm = Lexeme::IDENT;
+      }
+      break;
+    }
+
+    m_tokens.emplace_back(lxm, lno, (uint32_t)(off - bolOff + 1),
+                          (uint32_t)off, (uint32_t)len);
+    if (lxm == Lexeme::IDENT)
+      m_tokens.back().symbol = m_symbols.intern(rest.substr(0, len));
+    off += len;
+  }
+
+  // EOF is a one character token positioned on the last column of the
+  // final line
+  m_eof = Token(Lexeme::END_OF_FILE, lno, (uint32_t)(off - bolOff),
+                (uint32_t)off, 1);
+  m_tokens.push_back(m_eof);
+}
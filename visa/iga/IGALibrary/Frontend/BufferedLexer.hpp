@@ -13,34 +13,50 @@ SPDX-License-Identifier: MIT
 #include "../asserts.hpp"
 #include "Lexemes.hpp"
 
+#include <cstdint>
 #include <iostream>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // #define DUMP_LEXEMES
 
-#define YY_DECL iga::Lexeme yylex(yyscan_t yyscanner, unsigned int &inp_off)
-#ifndef YY_NO_UNISTD_H
-#define YY_NO_UNISTD_H
-#endif
-#include "lex.yy.hpp"
+namespace iga {
 
-YY_DECL;
+// Interns identifier spellings to dense ids.  The parser keys its
+// mnemonic and register lookups by these ids so that each distinct
+// identifier is resolved once per kernel rather than once per use.
+// Names are views into the lexer input.
+class SymbolTable {
+  std::vector<std::string_view> m_names;
+  std::vector<uint32_t> m_hashes; // parallel to m_names
+  // open addressed hash table of symbol + 1 (0 is an empty slot)
+  std::vector<uint32_t> m_slots;
 
-namespace iga {
+  void Grow();
+
+public:
+  static constexpr uint32_t NO_SYMBOL = 0xFFFFFFFF;
+
+  uint32_t intern(std::string_view name);
+  std::string_view name(uint32_t sym) const { return m_names[sym]; }
+  size_t size() const { return m_names.size(); }
+};
 
 struct Token {
   Lexeme lexeme;
   Loc loc;
+  // the interned spelling for IDENT tokens
+  uint32_t symbol = SymbolTable::NO_SYMBOL;
 
   Token() : lexeme(Lexeme::LEXICAL_ERROR) {}
   Token(const Lexeme &lxm, uint32_t ln, uint32_t cl, uint32_t off, uint32_t len)
       : lexeme(lxm), loc(ln, cl, off, len) {}
 };
 
-static void WriteTokenContext(const std::string &inp, const struct Loc &loc,
+static void WriteTokenContext(std::string_view inp, const struct Loc &loc,
                               std::ostream &os) {
   if (loc.offset >= (PC)inp.size()) {
     os << "<<EOF>>" << std::endl;
@@ -64,7 +80,7 @@ static void WriteTokenContext(const std::string &inp, const struct Loc &loc,
   }
 }
 
-static std::string GetTokenString(const Token &token, const std::string &inp) {
+static std::string GetTokenString(const Token &token, std::string_view inp) {
   std::stringstream ss;
   ss << token.loc.line << "." << token.loc.col << ": (" << token.loc.offset
      << "/" << token.loc.extent << "): " << LexemeString(token.lexeme)
@@ -73,69 +89,35 @@ static std::string GetTokenString(const Token &token, const std::string &inp) {
   return ss.str();
 }
 
+// Tokenizes the whole input up front (see BufferedLexer.cpp for the
+// lexical grammar).  The input is not copied; it must outlive the lexer.
 class BufferedLexer {
   std::vector<Token> m_tokens;
   size_t m_offset, m_mark; // token index of the scanner
 
-  const std::string m_input;
+  const std::string_view m_input;
+  SymbolTable m_symbols;
 
   Token m_eof;
 
+  void Tokenize();
+
 public:
-  BufferedLexer(const std::string &inp)
+  BufferedLexer(std::string_view inp)
       : m_offset(0), m_mark(0), m_input(inp),
         m_eof(Lexeme::END_OF_FILE, 0, 0, 0, 0) {
-    yyscan_t yy;
-
-    yylex_init(&yy);
-    yy_scan_string(inp.c_str(), yy);
-    yyset_lineno(1, yy);
-    yyset_column(1, yy);
-
-    unsigned int inpOff = 0, bolOff = 0;
-
-    Lexeme lxm;
-    while (true) {
-      lxm = yylex(yy, inpOff);
-
-      uint32_t lno = (uint32_t)yyget_lineno(yy);
-      uint32_t len = (uint32_t)yyget_leng(yy);
-      uint32_t col = (uint32_t)yyget_column(yy) - len;
-      uint32_t off = (uint32_t)inpOff;
-      if (lxm == Lexeme::NEWLINE) {
-        // flex increments yylineno and clear's column before this
-        // we fix this by backing up the newline for that case
-        // and inferring the final column from the beginning of
-        // the last line
-        lno--;
-        col = inpOff - bolOff + 1;
-        bolOff = inpOff;
-      }
-      // const char *str = yyget_text(yy);
-      // printf("AT %u.%u(%u:%u:\"%s\"): %s\n",
-      //  lno,col,off,len,str,LexemeString(lxm));
-      // struct Loc loc(lno,col,off,len);
-      // ShowToken(inp,loc,std::cout);
-
-      if (lxm == Lexeme::END_OF_FILE) {
-        m_eof = Token(lxm, lno, col, off, len); // update EOF w/ loc
-        m_tokens.push_back(m_eof);
-        break;
-      }
-      m_tokens.emplace_back(lxm, lno, col, off, len);
-      inpOff += len;
-    }
-
-    yylex_destroy(yy);
+    Tokenize();
   }
-  const std::string &GetSource() const { return m_input; }
+  std::string_view GetSource() const { return m_input; }
+  const SymbolTable &GetSymbols() const { return m_symbols; }
+  size_t GetTokenCount() const { return m_tokens.size(); }
 
   size_t GetTokenOffset() const { return m_offset; }
   void SetTokenOffset(size_t off) { m_offset = off; }
   void Mark() { m_mark = m_offset; }
   void Reset() { SetTokenOffset(m_mark); }
 
-  void DumpTokens(std::ostream &out, const std::string &inp) const {
+  void DumpTokens(std::ostream &out, std::string_view inp) const {
     for (const auto &t : m_tokens) {
       out << "AT" << t.loc.line << "." << t.loc.col << "(" << t.loc.offset
           << ":" << t.loc.extent << ": " << LexemeString(t.lexeme) << std::endl;
@@ -133,7 +133,7 @@ static const IdentMap<MathMacroExt> MATHMACROREGS_OLDSTYLE = {
 };
 
 GenParser::GenParser(const Model &model, InstBuilder &handler,
-                     const std::string &inp, ErrorHandler &eh,
+                     std::string_view inp, ErrorHandler &eh,
                      const ParseOpts &pots)
     : Parser(inp, eh), m_model(model), m_builder(handler), m_opts(pots) {
   initSymbolMaps();
@@ -182,7 +182,10 @@ bool GenParser::PeekReg(const RegInfo *&regInfo, int &regNum) {
   const Token &tk = Next();
   if (tk.lexeme != IDENT) {
     return false;
-  } else if (LookupReg(GetTokenAsString(tk), regInfo, regNum)) {
+  }
+  regInfo = m_symbolRegs[tk.symbol].regInfo;
+  regNum = m_symbolRegs[tk.symbol].regNum;
+  if (regInfo) {
     // helpful translation that permits acc2-acc9 and translates them
     // to mme0-7 with a warning (or whatever they map to on the given
     // platform
@@ -743,11 +746,25 @@ void GenParser::initSymbolMaps() {
       m_regmap[ri->syntax] = ri;
     }
   }
+
+  // resolve each distinct identifier once rather than on every use
+  const SymbolTable &syms = m_lexer.GetSymbols();
+  m_symbolRegs.resize(syms.size());
+  for (uint32_t sym = 0; sym < (uint32_t)syms.size(); sym++) {
+    SymbolReg &sr = m_symbolRegs[sym];
+    if (!LookupReg(std::string(syms.name(sym)), sr.regInfo, sr.regNum)) {
+      sr.regInfo = nullptr;
+      sr.regNum = 0;
+    }
+  }
 }
 
 class KernelParser : GenParser {
   // maps mnemonics and registers for faster lookup
   std::unordered_map<std::string, const OpSpec *> opmap;
+  // the op for each identifier of the input (indexed by Token::symbol)
+  // or nullptr if the identifier is not a mnemonic
+  std::vector<const OpSpec *> m_symbolOps;
 
   ExecSize m_defaultExecutionSize;
   Type m_defaultRegisterType;
@@ -773,7 +790,7 @@ private:
 
 
 public:
-  KernelParser(const Model &model, InstBuilder &handler, const std::string &inp,
+  KernelParser(const Model &model, InstBuilder &handler, std::string_view inp,
                ErrorHandler &eh, const ParseOpts &pots)
       : GenParser(model, handler, inp, eh, pots),
         m_defaultExecutionSize(ExecSize::SIMD1),
@@ -791,6 +808,13 @@ public:
         opmap[os->mnemonic] = os;
       }
     }
+    const SymbolTable &syms = m_lexer.GetSymbols();
+    m_symbolOps.resize(syms.size(), nullptr);
+    for (uint32_t sym = 0; sym < (uint32_t)syms.size(); sym++) {
+      auto itr = opmap.find(std::string(syms.name(sym)));
+      if (itr != opmap.end())
+        m_symbolOps[sym] = itr->second;
+    }
   }
 
   // Program = (Label? Insts* (Label Insts))?
@@ -1352,19 +1376,11 @@ public:
     if (tk.lexeme != IDENT) {
       return nullptr;
     }
-    const char *p = &m_lexer.GetSource()[tk.loc.offset];
-    std::string s;
-    s.reserve((size_t)tk.loc.extent + 1);
-    for (size_t i = 0; i < tk.loc.extent; i++) {
-      s += *p++;
-    }
-    auto itr = opmap.find(s);
-    if (itr == opmap.end()) {
-      return nullptr;
-    } else {
+    const OpSpec *os = m_symbolOps[tk.symbol];
+    if (os) {
       Skip();
-      return itr->second;
     }
+    return os;
   }
 
 #if 0
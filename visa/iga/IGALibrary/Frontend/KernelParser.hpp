@@ -19,6 +19,8 @@ SPDX-License-Identifier: MIT
 // #include <functional>
 #include <map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace iga {
 struct ParseOpts {
@@ -60,7 +62,7 @@ struct GenParser : public Parser {
   InstBuilder &m_builder;
   const ParseOpts m_opts;
 
-  GenParser(const Model &model, InstBuilder &handler, const std::string &inp,
+  GenParser(const Model &model, InstBuilder &handler, std::string_view inp,
             ErrorHandler &eh, const ParseOpts &pots);
 
   Platform platform() const { return m_model.platform; }
@@ -128,6 +130,13 @@ protected:
 private:
   void initSymbolMaps();
   std::map<std::string, const RegInfo *> m_regmap;
+  // LookupReg results for each identifier of the input, indexed by
+  // Token::symbol; regInfo is nullptr for identifiers that are not registers
+  struct SymbolReg {
+    const RegInfo *regInfo = nullptr;
+    int regNum = 0;
+  };
+  std::vector<SymbolReg> m_symbolRegs;
 }; // class GenParser
 } // namespace iga
 #endif
@@ -67,7 +67,8 @@ uint32_t Parser::ExtentTo(const Loc &start, const Loc &end) const {
 }
 
 std::string Parser::GetTokenAsString(const Token &token) const {
-  return m_lexer.GetSource().substr(token.loc.offset, token.loc.extent);
+  return std::string(
+      m_lexer.GetSource().substr(token.loc.offset, token.loc.extent));
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -124,7 +125,7 @@ bool Parser::PrefixAtEq(size_t off, const char *pfx) const {
   size_t slen = stringLength(pfx);
   if (off + slen > m_lexer.GetSource().size())
     return false;
-  return strncmp(pfx, &m_lexer.GetSource()[off], slen) == 0;
+  return strncmp(pfx, m_lexer.GetSource().data() + off, slen) == 0;
 }
 bool Parser::LookingAtIdentEq(const char *eq) const {
   return LookingAtIdentEq(0, eq);
@@ -168,7 +169,7 @@ bool Parser::TokenEq(const Token &tk, const char *eq) const {
   if (slen != tk.loc.extent ||
       tk.loc.offset + slen > m_lexer.GetSource().size())
     return false;
-  const char *str = &m_lexer.GetSource()[tk.loc.offset];
+  const char *str = m_lexer.GetSource().data() + tk.loc.offset;
   return strncmp(eq, str, slen) == 0;
   //    return strncmp(eq,&m_input[t.loc.offset],slen) == 0;
 }
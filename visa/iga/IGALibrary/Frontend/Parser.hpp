@@ -20,6 +20,7 @@ SPDX-License-Identifier: MIT
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -61,7 +62,7 @@ protected:
   ErrorHandler &m_errorHandler;
 
 public:
-  Parser(const std::string &inp, ErrorHandler &errHandler)
+  Parser(std::string_view inp, ErrorHandler &errHandler)
       : m_lexer(inp), m_errorHandler(errHandler) {}
 
   //////////////////////////////////////////////////////////////////////
@@ -236,7 +237,7 @@ public:
   }
 
   template <typename T> void ParseIntFrom(size_t off, size_t len, T &value) {
-    const std::string &src = m_lexer.GetSource();
+    std::string_view src = m_lexer.GetSource();
     value = 0;
     if (len > 2 && src[off] == '0' &&
         (src[off + 1] == 'b' || src[off + 1] == 'B')) {
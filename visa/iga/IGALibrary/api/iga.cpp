@@ -357,6 +357,13 @@ public:
         (aopts.encoder_opts & IGA_ENCODER_OPT_AUTO_DEPENDENCIES) != 0;
     eopts.sbidCount = aopts.sbid_count;
     eopts.swsbEncodeMode = aopts.swsb_encode_mode;
+    eopts.verifyFastEncode =
+        (aopts.encoder_opts & IGA_ENCODER_OPT_VERIFY_FAST_ENCODE) != 0;
+    eopts.fastEncode =
+        eopts.verifyFastEncode ||
+        (aopts.encoder_opts & IGA_ENCODER_OPT_FAST_ENCODE) != 0;
+    eopts.memoizeCompaction =
+        (aopts.encoder_opts & IGA_ENCODER_OPT_MEMOIZE_COMPACTION) != 0;
 
     if ((aopts.encoder_opts & IGA_ENCODER_OPT_USE_NATIVE) == 0) {
       if (!iga::ged::IsEncodeSupported(m_model, eopts)) {
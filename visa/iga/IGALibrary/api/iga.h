@@ -286,6 +286,15 @@ static_assert(sizeof(iga_assemble_options_t) == 8 * 4,
 /* forcely NoCompact to all instructions even if {Compacted} is set on the
    instruction This option will overried IGA_ENCODER_OPT_AUTO_COMPACT */
 #define IGA_ENCODER_OPT_FORCE_NO_COMPACT 0x00000010u
+/* reuse cached encodings of repeated instruction forms
+   (GED encoder, XE to XeHPC) */
+#define IGA_ENCODER_OPT_FAST_ENCODE 0x00000020u
+/* encode fast path instructions with GED as well and raise an error if the
+   encodings differ (implies IGA_ENCODER_OPT_FAST_ENCODE) */
+#define IGA_ENCODER_OPT_VERIFY_FAST_ENCODE 0x00000040u
+/* encode natively first and memoize the compaction of each native encoding
+   (pays off only when encodings repeat) */
+#define IGA_ENCODER_OPT_MEMOIZE_COMPACTION 0x00000080u
 
 /*
  * options for the parsing phase
@@ -18,9 +18,21 @@ iga_status_t KernelEncoder::encode(std::ostream &errStr) {
   EncoderOpts enc_opt(m_autoCompact, true);
   enc_opt.autoDepSet = m_enableAutoDeps;
   enc_opt.swsbEncodeMode = m_swsbEncodeMode;
+  enc_opt.fastEncode = m_fastEncode || m_verifyFastEncode;
+  enc_opt.verifyFastEncode = m_verifyFastEncode;
+  enc_opt.memoizeCompaction = m_memoizeCompaction;
+  enc_opt.stats = m_stats;
 
   Encoder enc(m_kernel->getModel(), errHandler, enc_opt);
   enc.encodeKernel(*m_kernel, m_kernel->getMemManager(), m_buf, m_binarySize);
+#ifndef _DEBUG
+  if (m_verifyFastEncode && errHandler.hasErrors()) {
+    for (auto &e : errHandler.getErrors()) {
+      errStr << "vISA inst $" << e.at.offset << ": " << e.message << "\n";
+    }
+    return IGA_ERROR;
+  }
+#endif // _DEBUG
 #ifdef _DEBUG
   if (errHandler.hasErrors()) {
     // failed encode
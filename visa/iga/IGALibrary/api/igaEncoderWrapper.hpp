@@ -9,6 +9,7 @@ SPDX-License-Identifier: MIT
 #ifndef _IGA_ENCODER_WRAPPER_HPP
 #define _IGA_ENCODER_WRAPPER_HPP
 
+#include "../Backend/EncoderOpts.hpp"
 #include "../IR/Kernel.hpp"
 #include "iga.h"
 
@@ -25,6 +26,12 @@ class KernelEncoder {
   // swsb encoding mode
   iga::SWSB_ENCODE_MODE m_swsbEncodeMode =
       iga::SWSB_ENCODE_MODE::SWSBInvalidMode;
+  // c.f. EncoderOpts::fastEncode and EncoderOpts::verifyFastEncode
+  bool m_fastEncode = false;
+  bool m_verifyFastEncode = false;
+  // c.f. EncoderOpts::memoizeCompaction
+  bool m_memoizeCompaction = false;
+  iga::EncoderStats *m_stats = nullptr;
 
 public:
   // @param compact: auto compact instructions if applicable
@@ -59,6 +66,20 @@ public:
   // enable IGA swsb set. When enabled, the original swsb in the input
   // instructions will be obsoleted
   void enableIGAAutoDeps(bool enable = true) { m_enableAutoDeps = enable; }
+
+  // encode repeated instruction forms from cached encodings
+  void enableFastEncode(bool enable = true) { m_fastEncode = enable; }
+  // check the cached encodings against GED; mismatches fail the encode
+  void enableVerifyFastEncode(bool enable = true) {
+    m_verifyFastEncode = enable;
+  }
+  // memoize compaction results per native encoding
+  void enableMemoizeCompaction(bool enable = true) {
+    m_memoizeCompaction = enable;
+  }
+
+  // accumulate encoding statistics (instruction counts, compaction) in stats
+  void setStats(iga::EncoderStats *stats) { m_stats = stats; }
 };
 
 #endif // _IGA_ENCODER_WRAPPER_HPP
@@ -328,6 +328,23 @@ typedef kv_status_t(CDECLATTRIBUTE *pIGAKVGetCacheOpt)(const kv_t *kv,
                                                        int32_t pc,
                                                        int32_t cache_level,
                                                        int32_t *cacheopt_enum);
+#define IGA_KV_GET_INST_COUNT_STR "kv_get_inst_count"
+typedef uint32_t(CDECLATTRIBUTE *pIGAKVGetInstCount)(const kv_t *kv);
+#define IGA_KV_GET_INSTS_STR "kv_get_insts"
+typedef uint32_t(CDECLATTRIBUTE *pIGAKVGetInsts)(const kv_t *kv, int32_t *pcs,
+                                                 int32_t *sizes,
+                                                 uint32_t *opcodes,
+                                                 uint32_t cap);
+#define IGA_KV_GET_BRANCH_TARGETS_STR "kv_get_branch_targets"
+typedef uint32_t(CDECLATTRIBUTE *pIGAKVGetBranchTargets)(const kv_t *kv,
+                                                         int32_t *from_pcs,
+                                                         int32_t *to_pcs,
+                                                         uint32_t cap);
+#define IGA_KV_GET_SENDS_STR "kv_get_sends"
+typedef uint32_t(CDECLATTRIBUTE *pIGAKVGetSends)(const kv_t *kv, int32_t *pcs,
+                                                 uint32_t *ex_descs,
+                                                 uint32_t *descs,
+                                                 uint32_t cap);
 /*
  * A table of IGA functions
  */
@@ -423,6 +440,10 @@ typedef struct {
   pIGAKVGetSrcMMENumber kv_get_source_mme_number;
   pIGAKVGetDstMMENumber kv_get_destination_mme_number;
   pIGAKVGetCacheOpt kv_get_cache_opt;
+  pIGAKVGetInstCount kv_get_inst_count;
+  pIGAKVGetInsts kv_get_insts;
+  pIGAKVGetBranchTargets kv_get_branch_targets;
+  pIGAKVGetSends kv_get_sends;
 } kv_functions_t;
 
 #endif // _IGAD_H_
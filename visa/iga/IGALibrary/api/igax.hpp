@@ -113,6 +113,11 @@ public:
   AsmResult assembleFromString(
       const std::string &text,
       const iga_assemble_options_t &opts = IGA_ASSEMBLE_OPTIONS_INIT());
+  // same as above, but assembles a NUL-terminated buffer in place
+  // (e.g. a memory mapped file)
+  AsmResult assembleFromString(
+      const char *text,
+      const iga_assemble_options_t &opts = IGA_ASSEMBLE_OPTIONS_INIT());
   // Disassembles a sequence of bits to a string
   DisResult disassembleToString(
       const void *bits, const size_t bitsLen,
@@ -305,11 +310,17 @@ inline Context::~Context() {
 inline AsmResult
 Context::assembleFromString(const std::string &text,
                             const iga_assemble_options_t &opts) {
+  return assembleFromString(text.c_str(), opts);
+}
+
+inline AsmResult
+Context::assembleFromString(const char *text,
+                            const iga_assemble_options_t &opts) {
   AsmResult result;
   void *bits;
   uint32_t bitsLen;
 
-  iga_status_t st = iga_assemble(context, &opts, text.c_str(), &bits, &bitsLen);
+  iga_status_t st = iga_assemble(context, &opts, text, &bits, &bitsLen);
   if (st != IGA_SUCCESS) {
     if (st == IGA_UNSUPPORTED_PLATFORM) {
       std::vector<Diagnostic> errs;
@@ -18,8 +18,10 @@ SPDX-License-Identifier: MIT
 #include "../IR/Messages.hpp"
 #include "../strings.hpp"
 
+#include <algorithm>
 #include <mutex>
 #include <sstream>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -28,19 +30,70 @@ SPDX-License-Identifier: MIT
 ///////////////////////////////////////////////////////////////////////////////
 using namespace iga;
 
+// Appends the JIP/UIP label targets of a branching instruction to 'pcs'
+// (if non-null) and returns how many there are.
+static uint32_t getInstTargets(const Instruction *inst, int32_t *pcs) {
+  if (inst->getOp() == Op::ILLEGAL || !inst->getOpSpec().isBranching()) {
+    return 0;
+  }
+
+  uint32_t nSrcs = 0;
+
+  if (inst->getSourceCount() > 0) {
+    const Operand &op = inst->getSource(SourceIndex::SRC0);
+    if (op.getKind() == Operand::Kind::LABEL) {
+      if (pcs)
+        pcs[nSrcs] = inst->getJIP()->getPC();
+      nSrcs++;
+    }
+  }
+
+  if (inst->getSourceCount() > 1) {
+    const Operand &op = inst->getSource(SourceIndex::SRC1);
+    if (op.getKind() == Operand::Kind::LABEL) {
+      if (pcs)
+        pcs[nSrcs] = inst->getUIP()->getPC();
+      nSrcs++;
+    }
+  }
+
+  return nSrcs;
+}
+
 class KernelViewImpl {
 private:
   KernelViewImpl(const KernelViewImpl &k)
       : m_model(*Model::LookupModel(k.m_model.platform)) {}
 
+  // instructions are 8 (compacted) or 16 bytes, so every instruction and
+  // block starts on an 8 byte boundary; the per-PC tables are indexed by
+  // PC / PC_GRANULE
+  static const int32_t PC_GRANULE = 8;
+
+  static size_t pcSlot(int32_t pc) { return (size_t)pc / PC_GRANULE; }
+  static bool isValidPc(int32_t pc) { return pc >= 0 && pc % PC_GRANULE == 0; }
+
 public:
   const Model &m_model;
   Kernel *m_kernel = nullptr;
   ErrorHandler m_errHandler;
-  std::map<uint32_t, const Instruction *> m_instsByPc;
-  std::map<uint32_t, const Block *> m_blockToPcMap;
+  std::vector<const Instruction *> m_instsByPc;
+  std::vector<const Block *> m_blocksByPc;
   DepAnalysis *m_liveAnalysis = nullptr;
 
+  // Tables backing the bulk queries; all are in PC order.  The instruction
+  // tables are parallel arrays with one entry per instruction, the branch
+  // tables one entry per (source, target) edge and the send tables one
+  // entry per send instruction.
+  std::vector<int32_t> m_instPcs;
+  std::vector<int32_t> m_instSizes;
+  std::vector<uint32_t> m_instOpcodes;
+  std::vector<int32_t> m_branchFromPcs;
+  std::vector<int32_t> m_branchToPcs;
+  std::vector<int32_t> m_sendPcs;
+  std::vector<uint32_t> m_sendExDescs;
+  std::vector<uint32_t> m_sendDescs;
+
   KernelViewImpl(const Model &model, const void *bytes, size_t bytesLength,
                  SWSB_ENCODE_MODE swsbOverride)
       : m_model(model)
@@ -52,12 +105,7 @@ public:
     }
     m_kernel = decoder.decodeKernelBlocks(bytes, bytesLength);
 
-    for (const Block *b : m_kernel->getBlockList()) {
-      m_blockToPcMap[b->getPC()] = b;
-      for (const Instruction *inst : b->getInstList()) {
-        m_instsByPc[inst->getPC()] = inst;
-      }
-    }
+    buildTables();
   }
 
   ~KernelViewImpl() {
@@ -70,22 +118,85 @@ public:
   }
 
   const Instruction *getInstruction(int32_t pc) const {
-    auto itr = m_instsByPc.find(pc);
-    if (itr == m_instsByPc.end()) {
+    if (!isValidPc(pc) || pcSlot(pc) >= m_instsByPc.size()) {
       return nullptr;
     }
-    return itr->second;
+    return m_instsByPc[pcSlot(pc)];
   }
 
   const Block *getBlock(int32_t pc) const {
-    auto itr = m_blockToPcMap.find(pc);
-    if (itr == m_blockToPcMap.end()) {
+    if (!isValidPc(pc) || pcSlot(pc) >= m_blocksByPc.size()) {
       return nullptr;
     }
-    return itr->second;
+    return m_blocksByPc[pcSlot(pc)];
+  }
+
+private:
+  void buildTables() {
+    // a block may start at the end of the kernel (e.g. a label after the
+    // last instruction), so size the tables by the largest PC seen
+    size_t slots = 0;
+    for (const Block *b : m_kernel->getBlockList()) {
+      slots = std::max(slots, pcSlot(b->getPC()) + 1);
+      if (!b->getInstList().empty()) {
+        slots =
+            std::max(slots, pcSlot(b->getInstList().back()->getPC()) + 1);
+      }
+    }
+    m_instsByPc.resize(slots, nullptr);
+    m_blocksByPc.resize(slots, nullptr);
+
+    size_t numInsts = 0;
+    for (const Block *b : m_kernel->getBlockList()) {
+      m_blocksByPc[pcSlot(b->getPC())] = b;
+      for (const Instruction *inst : b->getInstList()) {
+        m_instsByPc[pcSlot(inst->getPC())] = inst;
+        numInsts++;
+      }
+    }
+
+    // walking the dense table yields the instructions in PC order
+    m_instPcs.reserve(numInsts);
+    m_instSizes.reserve(numInsts);
+    m_instOpcodes.reserve(numInsts);
+    for (const Instruction *inst : m_instsByPc) {
+      if (!inst) {
+        continue;
+      }
+      const int32_t pc = inst->getPC();
+      m_instPcs.push_back(pc);
+      m_instSizes.push_back(inst->hasInstOpt(InstOpt::COMPACTED) ? 8 : 16);
+      m_instOpcodes.push_back(static_cast<uint32_t>(inst->getOpSpec().op));
+
+      int32_t targets[KV_MAX_TARGETS_PER_INSTRUCTION];
+      uint32_t nTargets = getInstTargets(inst, targets);
+      for (uint32_t i = 0; i < nTargets; i++) {
+        m_branchFromPcs.push_back(pc);
+        m_branchToPcs.push_back(targets[i]);
+      }
+
+      if (inst->getOpSpec().isAnySendFormat()) {
+        const SendDesc exDesc = inst->getExtMsgDescriptor();
+        const SendDesc desc = inst->getMsgDescriptor();
+        m_sendPcs.push_back(pc);
+        m_sendExDescs.push_back(exDesc.isImm() ? exDesc.imm
+                                               : KV_INVALID_SEND_DESC);
+        m_sendDescs.push_back(desc.isImm() ? desc.imm : KV_INVALID_SEND_DESC);
+      }
+    }
   }
 };
 
+// Copies the first 'cap' elements of 'src' into 'dst' (if non-null) and
+// returns the full element count.
+template <typename T>
+static uint32_t copyOutTable(const std::vector<T> &src, T *dst, uint32_t cap) {
+  if (dst) {
+    std::copy_n(src.begin(), std::min((size_t)cap, src.size()), dst);
+  }
+  return (uint32_t)src.size();
+}
+
 kv_t *kv_create(iga_gen_t gen_platf, const void *bytes, size_t bytes_len,
                 iga_status_t *status, char *errbuf, size_t errbuf_cap,
                 SWSB_ENCODE_MODE swsbMode) {
@@ -186,35 +297,10 @@ uint32_t kv_get_inst_targets(const kv_t *kv, int32_t pc, int32_t *pcs) {
     return 0;
 
   const Instruction *inst = ((KernelViewImpl *)kv)->getInstruction(pc);
-  if (!inst || inst->getOp() == Op::ILLEGAL) {
-    return 0;
-  }
-
-  if (!inst->getOpSpec().isBranching()) {
+  if (!inst) {
     return 0;
   }
-
-  uint32_t nSrcs = 0;
-
-  if (inst->getSourceCount() > 0) {
-    const Operand &op = inst->getSource(SourceIndex::SRC0);
-    if (op.getKind() == Operand::Kind::LABEL) {
-      if (pcs)
-        pcs[nSrcs] = inst->getJIP()->getPC();
-      nSrcs++;
-    }
-  }
-
-  if (inst->getSourceCount() > 1) {
-    const Operand &op = inst->getSource(SourceIndex::SRC1);
-    if (op.getKind() == Operand::Kind::LABEL) {
-      if (pcs)
-        pcs[nSrcs] = inst->getUIP()->getPC();
-      nSrcs++;
-    }
-  }
-
-  return nSrcs;
+  return getInstTargets(inst, pcs);
 }
 
 size_t kv_get_inst_syntax(const kv_t *kv, int32_t pc, char *sbuf,
@@ -353,6 +439,42 @@ kv_status_t kv_get_send_indirect_descs(const kv_t *kv, int32_t pc,
 }
 
 
+/******************** KernelView bulk query APIs *****************************/
+uint32_t kv_get_inst_count(const kv_t *kv) {
+  if (!kv)
+    return 0;
+  return (uint32_t)((const KernelViewImpl *)kv)->m_instPcs.size();
+}
+
+uint32_t kv_get_insts(const kv_t *kv, int32_t *pcs, int32_t *sizes,
+                      uint32_t *opcodes, uint32_t cap) {
+  if (!kv)
+    return 0;
+  const KernelViewImpl *kvImpl = (const KernelViewImpl *)kv;
+  copyOutTable(kvImpl->m_instSizes, sizes, cap);
+  copyOutTable(kvImpl->m_instOpcodes, opcodes, cap);
+  return copyOutTable(kvImpl->m_instPcs, pcs, cap);
+}
+
+uint32_t kv_get_branch_targets(const kv_t *kv, int32_t *from_pcs,
+                               int32_t *to_pcs, uint32_t cap) {
+  if (!kv)
+    return 0;
+  const KernelViewImpl *kvImpl = (const KernelViewImpl *)kv;
+  copyOutTable(kvImpl->m_branchToPcs, to_pcs, cap);
+  return copyOutTable(kvImpl->m_branchFromPcs, from_pcs, cap);
+}
+
+uint32_t kv_get_sends(const kv_t *kv, int32_t *pcs, uint32_t *ex_descs,
+                      uint32_t *descs, uint32_t cap) {
+  if (!kv)
+    return 0;
+  const KernelViewImpl *kvImpl = (const KernelViewImpl *)kv;
+  copyOutTable(kvImpl->m_sendExDescs, ex_descs, cap);
+  copyOutTable(kvImpl->m_sendDescs, descs, cap);
+  return copyOutTable(kvImpl->m_sendPcs, pcs, cap);
+}
+
 /******************** KernelView analysis APIs *******************************/
 static const Instruction *getInstruction(const kv_t *kv, int32_t pc) {
   if (!kv) {
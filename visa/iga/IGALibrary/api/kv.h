@@ -201,6 +201,45 @@ IGA_API int32_t kv_get_opgroup(const kv_t *kv, int32_t pc);
 IGA_API uint32_t kv_get_send_descs(const kv_t *kv, int32_t pc,
                                    uint32_t *ex_desc, uint32_t *desc);
 
+/*
+ * Bulk queries.  These answer the per-PC questions above for the whole
+ * kernel at once from tables built when the view is created; tools that
+ * visit every instruction should prefer them over iterating PCs.
+ *
+ * Each function returns the total number of entries and copies the first
+ * 'cap' of them (in PC order) into the caller's arrays.  Any array may be
+ * NULL, in which case it is ignored; passing all NULL (or a 'cap' of 0)
+ * just returns the count so the caller can size its buffers.
+ */
+
+/*
+ * Returns the number of instructions in the kernel.
+ */
+IGA_API uint32_t kv_get_inst_count(const kv_t *kv);
+
+/*
+ * Returns the PC, size (see kv_get_inst_size) and opcode (see kv_get_opcode)
+ * of every instruction.
+ */
+IGA_API uint32_t kv_get_insts(const kv_t *kv, int32_t *pcs, int32_t *sizes,
+                              uint32_t *opcodes, uint32_t cap);
+
+/*
+ * Returns every branch edge of the kernel: 'from_pcs[i]' is a branching
+ * instruction and 'to_pcs[i]' one of its targets (see kv_get_inst_targets).
+ * Instructions with several targets contribute several consecutive edges.
+ */
+IGA_API uint32_t kv_get_branch_targets(const kv_t *kv, int32_t *from_pcs,
+                                       int32_t *to_pcs, uint32_t cap);
+
+/*
+ * Returns the PC and descriptors of every send instruction.  Descriptors
+ * that are not immediate are set to KV_INVALID_SEND_DESC
+ * (see kv_get_send_descs).
+ */
+IGA_API uint32_t kv_get_sends(const kv_t *kv, int32_t *pcs, uint32_t *ex_descs,
+                              uint32_t *descs, uint32_t cap);
+
 
 /*
  * Returns the indirect descriptor registers for a send message.
@@ -110,6 +110,29 @@ public:
     return (size_t)kv_get_inst_targets(m_kv, pc, targetPcs);
   }
 
+  // Bulk queries over the whole kernel (see kv_get_insts and friends).
+  // Each returns the total entry count and fills up to 'cap' entries of
+  // the non-null arrays in PC order.
+  //
+  //  std::vector<int32_t> pcs(k.getInstCount()), sizes(pcs.size());
+  //  k.getInsts(pcs.data(), sizes.data(), nullptr, pcs.size());
+  size_t getInstCount() const { return (size_t)kv_get_inst_count(m_kv); }
+
+  size_t getInsts(int32_t *pcs, int32_t *sizes, uint32_t *opcodes,
+                  size_t cap) const {
+    return (size_t)kv_get_insts(m_kv, pcs, sizes, opcodes, (uint32_t)cap);
+  }
+
+  size_t getBranchTargets(int32_t *fromPcs, int32_t *toPcs,
+                          size_t cap) const {
+    return (size_t)kv_get_branch_targets(m_kv, fromPcs, toPcs, (uint32_t)cap);
+  }
+
+  size_t getSends(int32_t *pcs, uint32_t *exDescs, uint32_t *descs,
+                  size_t cap) const {
+    return (size_t)kv_get_sends(m_kv, pcs, exDescs, descs, (uint32_t)cap);
+  }
+
   //  size_t count =  k.getInstTargetsCount(pc);
   //  if (count > 1) {
   //      int32_t jip = k.getInstJIP(pc);
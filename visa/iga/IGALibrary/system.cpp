@@ -22,7 +22,9 @@ SPDX-License-Identifier: MIT
 #define IS_STDERR_TTY (isatty(STDERR_FILENO) != 0)
 #define IS_STDOUT_TTY (isatty(STDOUT_FILENO) != 0)
 #include <errno.h>
+#include <fcntl.h>
 #include <string.h> // strerror_r
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -102,6 +104,117 @@ bool iga::DoesFileExist(const std::string &path) {
 #endif
 }
 
+// Mapping small files costs more than reading them.
+static const size_t MIN_MAPPED_FILE_SIZE = 16 * 1024;
+
+bool iga::MappedFile::open(const std::string &path) {
+  close();
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize)) {
+    CloseHandle(file);
+    return false;
+  }
+  const size_t size = (size_t)fileSize.QuadPart;
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  if (size >= MIN_MAPPED_FILE_SIZE && size % si.dwPageSize != 0) {
+    HANDLE mapping =
+        CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void *view =
+        mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view) {
+      CloseHandle(file);
+      m_mapping = mapping;
+      m_view = view;
+      m_viewSize = size;
+      m_data = (const char *)view;
+      m_size = size;
+      return true;
+    }
+    if (mapping)
+      CloseHandle(mapping);
+  }
+  // fall back to reading the file
+  m_buffer.resize(size + 1);
+  size_t total = 0;
+  while (total < size) {
+    DWORD chunk = (DWORD)std::min<size_t>(size - total, 1u << 30), n = 0;
+    if (!ReadFile(file, m_buffer.data() + total, chunk, &n, nullptr) ||
+        n == 0) {
+      break;
+    }
+    total += n;
+  }
+  CloseHandle(file);
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat sb;
+  if (fstat(fd, &sb) != 0) {
+    ::close(fd);
+    return false;
+  }
+  const size_t size = (size_t)sb.st_size;
+  const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+  if (S_ISREG(sb.st_mode) && size >= MIN_MAPPED_FILE_SIZE &&
+      size % pageSize != 0) {
+    void *view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view != MAP_FAILED) {
+      ::close(fd);
+      m_view = view;
+      m_viewSize = size;
+      m_data = (const char *)view;
+      m_size = size;
+      return true;
+    }
+  }
+  // fall back to reading the file
+  m_buffer.resize(size + 1);
+  size_t total = 0;
+  while (total < size) {
+    ssize_t n = ::read(fd, m_buffer.data() + total, size - total);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    total += (size_t)n;
+  }
+  ::close(fd);
+#endif
+  if (total != size) {
+    m_buffer.clear();
+    return false;
+  }
+  m_buffer[size] = 0;
+  m_data = m_buffer.data();
+  m_size = size;
+  return true;
+}
+
+void iga::MappedFile::close() {
+  if (m_view) {
+#ifdef _WIN32
+    UnmapViewOfFile(m_view);
+    CloseHandle(m_mapping);
+    m_mapping = nullptr;
+#else
+    munmap(m_view, m_viewSize);
+#endif
+    m_view = nullptr;
+    m_viewSize = 0;
+  }
+  m_buffer.clear();
+  m_data = nullptr;
+  m_size = 0;
+}
+
 // Use the color API's below.
 //   emitRedText(std::ostream&,const T&)
 //   emit###Text(std::ostream&,const T&)
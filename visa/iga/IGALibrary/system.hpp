@@ -9,8 +9,10 @@ SPDX-License-Identifier: MIT
 #ifndef SYSTEM_HPP
 #define SYSTEM_HPP
 
+#include <cstddef>
 #include <ostream>
 #include <string>
+#include <vector>
 
 namespace iga {
 bool IsStdoutTty();
@@ -37,6 +39,36 @@ static inline std::string LastErrorString() {
   return FormatLastError(LastError());
 }
 
+// A read-only copy of a file's contents followed by a NUL, so that it can
+// be handed to APIs taking C strings.  Larger files are memory mapped when
+// the bytes after the end of the file are guaranteed to be zero (i.e. the
+// file size is not a multiple of the page size); the rest are read into a
+// private buffer.
+class MappedFile {
+  const char *m_data = nullptr;
+  size_t m_size = 0;
+  void *m_view = nullptr; // base of the mapping (nullptr if m_buffer is used)
+  size_t m_viewSize = 0;
+#ifdef _WIN32
+  void *m_mapping = nullptr;
+#endif
+  std::vector<char> m_buffer;
+
+public:
+  MappedFile() = default;
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile() { close(); }
+
+  // returns false on failure with LastError() set
+  bool open(const std::string &path);
+  void close();
+
+  const char *data() const { return m_data; }
+  size_t size() const { return m_size; }
+  bool isMapped() const { return m_view != nullptr; }
+};
+
 // deals with large Windows paths on Windows platforms
 // identity function on other platforms
 std::string FixupPath(const std::string &path);
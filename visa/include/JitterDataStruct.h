@@ -28,6 +28,14 @@ struct VISA_BB_INFO {
   unsigned char loopNestLevel;
 };
 
+// What limits the estimated throughput of a kernel.
+enum class PERF_BOTTLENECK : uint8_t {
+  NONE,
+  ALU,  // ALU issue and register dependences
+  SEND, // send and dpas issue
+  SYNC, // waiting on SWSB tokens of outstanding sends
+};
+
 // PERF_STATS_CORE - the core vISA static performance stats
 // This set of stats may be used not only for stats report, but for
 // other purposes such as spill cost estimation by IGC.
@@ -80,6 +88,14 @@ public:
   uint32_t staticCycle = 0;
   uint32_t loopNestedStallCycle = 0;
   uint32_t loopNestedCycle = 0;
+
+  // Throughput estimate of the final code, after SWSB. Cycles are weighted by
+  // loop like loopNestedCycle and split by what the thread is waiting for.
+  uint32_t estCycle = 0;
+  uint32_t estALUCycle = 0;
+  uint32_t estSendCycle = 0;
+  uint32_t estSyncCycle = 0;
+  PERF_BOTTLENECK estBottleneck = PERF_BOTTLENECK::NONE;
 };
 
 // PERF_STATS_VERBOSE - the verbose vISA static performance stats.
@@ -151,6 +167,12 @@ struct PERF_STATS_VERBOSE {
   uint32_t normIntfNum = 0;
   // Number of SIMD inteference edges.
   uint32_t augIntfNum = 0;
+
+  // Number of times the dominator tree, post-dominator tree and loop
+  // analysis of the FlowGraph were (re)computed.
+  uint32_t domRebuildNum = 0;
+  uint32_t postDomRebuildNum = 0;
+  uint32_t loopRebuildNum = 0;
 };
 
 struct FINALIZER_INFO {
@@ -12,6 +12,7 @@ SPDX-License-Identifier: MIT
 #include "JitterDataStruct.h"
 #include "KernelInfo.h"
 #include "RelocationInfo.h"
+#include "VISADebugInfoSink.h"
 #include "VISAOptions.h"
 #include "visa_igc_common_header.h"
 
@@ -1154,6 +1155,13 @@ public:
   VISA_BUILDER_API virtual int GetGenxDebugInfo(void *&buffer,
                                                 unsigned int &size) const = 0;
 
+  /// SetGenxDebugInfoSink -- hand the GEN debug info to <sink> as structured
+  /// records while the kernel is compiled, instead of producing the binary
+  /// returned by GetGenxDebugInfo. Must be called before Compile(). When a
+  /// sink is set, GetGenxDebugInfo returns a null buffer.
+  VISA_BUILDER_API virtual int
+  SetGenxDebugInfoSink(vISA::DebugInfoSink *sink) = 0;
+
   /// GetGenRelocEntryBuffer -- allocate and return a buffer of all
   /// GenRelocEntry that are created by vISA
   VISA_BUILDER_API virtual int
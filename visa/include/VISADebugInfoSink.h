@@ -0,0 +1,73 @@
+/*========================== begin_copyright_notice ============================
+
+Copyright (C) 2024 Intel Corporation
+
+SPDX-License-Identifier: MIT
+
+============================= end_copyright_notice ===========================*/
+
+#ifndef VISA_DEBUG_INFO_SINK_H
+#define VISA_DEBUG_INFO_SINK_H
+
+#include <cstdint>
+
+namespace vISA {
+
+// Location of a variable over a range of vISA indices (variables, subroutine
+// return values) or Gen offsets (frame descriptor entries).
+struct DebugInfoLiveInterval {
+  uint32_t start = 0;
+  uint32_t end = 0;
+  // VARMAP_VREG_FILE_* and VARMAP_PREG_FILE_* encodings
+  uint8_t virtualType = 0;
+  uint8_t physicalType = 0;
+  // Valid when physicalType is a register file.
+  uint16_t regNum = 0;
+  uint16_t subRegNum = 0;
+  // Valid when physicalType is memory. The MSB is set when the offset is
+  // absolute rather than relative to BE_FP.
+  uint32_t memOffset = 0;
+};
+
+// One saved register range at a save/restore instruction.
+struct DebugInfoRegSaveMapping {
+  uint16_t srcRegOff = 0;
+  uint16_t numBytes = 0;
+  bool dstInReg = false;
+  uint16_t dstRegNum = 0;
+  // Raw memory offset, MSB set when absolute.
+  uint32_t dstMemOffset = 0;
+};
+
+// Receives the Gen debug info of a kernel and the stack call functions it
+// references as structured records, instead of the binary buffer returned by
+// VISAKernel::GetGenxDebugInfo. The records describe the same data as the
+// binary format, in the same order. Calls follow a cursor protocol: the
+// begin* calls open a record and the add* calls after them append to the
+// record opened last.
+class DebugInfoSink {
+public:
+  enum class FrameEntry { BEFP, CallerBEFP, RetAddr };
+
+  virtual ~DebugInfoSink() = default;
+
+  virtual void beginCompiledObject(const char *name, uint32_t relocOffset) = 0;
+  virtual void addCISAOffset(uint32_t cisaOffset, uint32_t genOffset) = 0;
+  virtual void addCISAIndex(uint32_t cisaIndex, uint32_t genOffset) = 0;
+
+  // Live intervals added after beginVariable/beginSubroutine/beginFrameEntry
+  // belong to that variable, subroutine return value or frame entry.
+  virtual void beginVariable(const char *name) = 0;
+  virtual void beginSubroutine(const char *name, uint32_t startVISAIndex,
+                               uint32_t endVISAIndex) = 0;
+  virtual void setFrameSize(uint16_t frameSize) = 0;
+  virtual void beginFrameEntry(FrameEntry entry) = 0;
+  virtual void addLiveInterval(const DebugInfoLiveInterval &lr) = 0;
+
+  virtual void beginRegSave(bool isCalleeSave, uint32_t genIPOffset) = 0;
+  virtual void addRegSaveMapping(const DebugInfoRegSaveMapping &mapping) = 0;
+};
+
+} // namespace vISA
+
+#endif // VISA_DEBUG_INFO_SINK_H
@@ -150,6 +150,14 @@ DEF_VISA_OPTION(vISA_hasDoubleAcc, ET_BOOL, "-hasDoubleAcc", UNUSED, false)
 DEF_VISA_OPTION(vISA_finiteMathOnly, ET_BOOL, "-finiteMathOnly",
                 "If set, float operands do not have NaN/Inf", false)
 DEF_VISA_OPTION(vISA_ifCvt, ET_BOOL, "-noifcvt", UNUSED, true)
+DEF_VISA_OPTION(vISA_BlockProfile, ET_CSTR, "-blockProfile",
+                "USAGE: -blockProfile <file>. Per-block execution counts, one "
+                "'<kernel> <label> <count>' entry per line, used to move cold "
+                "blocks out of the hot path", NULL)
+DEF_VISA_OPTION(vISA_BlockProfileColdThreshold, ET_INT32,
+                "-blockProfileColdThreshold",
+                "USAGE: -blockProfileColdThreshold <count>. Blocks executed at "
+                "most this many times are considered cold", 0)
 DEF_VISA_OPTION(vISA_RegSharingHeuristics, ET_BOOL, "-regSharingHeuristics",
                 UNUSED, false)
 DEF_VISA_OPTION(vISA_LVN, ET_BOOL, "-nolvn", UNUSED, true)
@@ -216,6 +224,10 @@ DEF_VISA_OPTION(vISA_renderTargetWriteSendReloc, ET_BOOL,
         "Enables adding offsets of all Render Target Write send instructions to the relocation table.", false)
 DEF_VISA_OPTION(vISA_CodePatch, ET_INT32, "-codePatch", UNUSED, 0)
 DEF_VISA_OPTION(vISA_Linker, ET_INT32, "-linker", UNUSED, 0)
+// Number of threads used to compile stack-call functions before they are
+// stitched to their callers. 0 or 1 compiles them in order on this thread.
+DEF_VISA_OPTION(vISA_ParallelFuncCompile, ET_INT32, "-parallelFuncCompile",
+                "USAGE: -parallelFuncCompile <num threads>\n", 0)
 DEF_VISA_OPTION(vISA_SSOShifter, ET_INT32, "-paddingSSOShifter", UNUSED, 9)
 DEF_VISA_OPTION(vISA_SkipPaddingScratchSpaceSize, ET_INT32, "-skipPaddingScratchSpaceSize", UNUSED, 4096)
 DEF_VISA_OPTION(vISA_lscEnableImmOffsFor, ET_INT32, "-lscEnableImmOffsFor",
@@ -340,6 +352,10 @@ DEF_VISA_OPTION(vISA_preRA_ScheduleRPThreshold, ET_INT32, "-presched-rp",
                 "USAGE: -presched-rp <threshold>\n", 0)
 DEF_VISA_OPTION(vISA_preRA_ScheduleExtraGRF, ET_INT32, "-presched-extra-grf",
                 "USAGE: -presched-extra-grf <num>\n", 0)
+DEF_VISA_OPTION(vISA_preRA_ScheduleSuperblock, ET_BOOL, "-presched-superblock",
+                "USAGE: -presched-superblock. Hoist long-latency instructions "
+                "across block boundaries within superblocks before pre-RA "
+                "scheduling", false)
 DEF_VISA_OPTION(vISA_ScheduleStartBBID, ET_INT32, "-sched-start",
                 "USAGE: -sched-start <BB ID>\n", 0)
 DEF_VISA_OPTION(vISA_ScheduleEndBBID, ET_INT32, "-sched-end",
@@ -461,6 +477,15 @@ DEF_VISA_OPTION(vISA_EnableRRAccSub, ET_BOOL, "-roundRobinAccSub", UNUSED,
 DEF_VISA_OPTION(vISA_Compaction, ET_BOOL, "-nocompaction", UNUSED, true)
 DEF_VISA_OPTION(vISA_BXMLEncoder, ET_BOOL, "-nobxmlencoder", UNUSED, true)
 DEF_VISA_OPTION(vISA_IGAEncoder, ET_BOOL, "-IGAEncoder", UNUSED, false)
+DEF_VISA_OPTION(vISA_IGAFastEncode, ET_BOOL, "-noIGAFastEncode",
+                "encode every instruction with GED", true)
+DEF_VISA_OPTION(vISA_IGAVerifyFastEncode, ET_BOOL, "-verifyIGAFastEncode",
+                "check the IGA fast encode path against GED", false)
+DEF_VISA_OPTION(vISA_IGAMemoizeCompaction, ET_BOOL, "-IGAMemoizeCompaction",
+                "memoize IGA compaction results per native encoding", false)
+DEF_VISA_OPTION(vISA_dumpIGAEncodeStats, ET_BOOL, "-dumpIGAEncodeStats",
+                "print IGA encoding and compaction statistics per kernel",
+                false)
 
 //=== asm/isaasm/isa emission options ===
 DEF_VISA_OPTION(vISA_outputToFile, ET_BOOL, "-output", UNUSED, false)